@@ -0,0 +1,68 @@
+#include "c2mm/mock/Call_Log.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Tuple_Matcher.hpp"
+#include "c2mm/mock/storage/Chunked.hpp"
+#include "c2mm/mock/storage/Heap.hpp"
+
+#include "utils.hpp"
+
+namespace {
+template <typename T_Storage>
+using Log = c2mm::mock::Call_Log<
+    std::tuple<int, std::string>,
+    c2mm::bench::Ignore,
+    T_Storage
+>;
+
+template <typename T_Storage>
+void benchmark_storage (std::string const& storage_name) {
+    using c2mm::bench::scaled;
+    using c2mm::matchers::matches;
+
+    for (int num_calls : {10, 100, 1000, 10000}) {
+        BENCHMARK (scaled(storage_name + ": log", "calls", num_calls)) {
+            Log<T_Storage> log{};
+            for (int i = 0; i < num_calls; ++i) {
+                log.log(i, "argument");
+            }
+            return log.size();
+        };
+
+        BENCHMARK_ADVANCED (
+            scaled(storage_name + ": consume_match in order", "calls", num_calls)
+        ) (Catch::Benchmark::Chronometer meter) {
+            std::vector<Log<T_Storage>> logs(meter.runs());
+            for (auto& log : logs) {
+                for (int i = 0; i < num_calls; ++i) {
+                    log.log(i, "argument");
+                }
+            }
+
+            meter.measure([&logs, num_calls] (int run) {
+                bool all_found = true;
+                for (int i = 0; i < num_calls; ++i) {
+                    all_found = logs[run].consume_match(
+                        matches(std::tuple{i, "argument"})
+                    ) and all_found;
+                }
+                return all_found;
+            });
+        };
+    }
+}
+}  // namespace
+
+TEST_CASE ("Call_Log::log and consume_match vs. log size") {
+    using c2mm::mock::storage::Chunked;
+    using c2mm::mock::storage::Heap;
+
+    benchmark_storage<Heap>("Heap");
+    benchmark_storage<Chunked<>>("Chunked");
+}
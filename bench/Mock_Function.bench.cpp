@@ -0,0 +1,275 @@
+#include "c2mm/mock/Mock_Function.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/mock/capture/Drop.hpp"
+#include "c2mm/mock/capture/Fingerprint.hpp"
+#include "c2mm/mock/capture/Project.hpp"
+#include "c2mm/mock/storage/Counting.hpp"
+#include "c2mm/mock/threading/Multi_Threaded.hpp"
+
+#include "utils.hpp"
+
+namespace {
+using Func = c2mm::mock::Mock_Function<
+    void(int, int),
+    c2mm::bench::Ignore,
+    c2mm::mock::storage::Counting
+>;
+
+using Shared_Func = c2mm::mock::Mock_Function<
+    void(int, int),
+    c2mm::bench::Ignore,
+    c2mm::mock::storage::Counting,
+    c2mm::mock::threading::Multi_Threaded<>
+>;
+
+using Logging_Func = c2mm::mock::Mock_Function<
+    void(int, int),
+    c2mm::bench::Ignore
+>;
+
+// One mock per benchmark run, each with `num_calls` logged calls.
+std::vector<Logging_Func> logged_mocks (int num_runs, int num_calls) {
+    std::vector<Logging_Func> funcs(num_runs);
+    for (auto& func : funcs) {
+        for (int i = 0; i < num_calls; ++i) {
+            func(int{i}, int{i});
+        }
+    }
+    return funcs;
+}
+}  // namespace
+
+TEST_CASE ("Mock_Function::operator() vs. expectation count") {
+    using c2mm::bench::scaled;
+    using c2mm::matchers::less_than;
+
+    for (int num_expectations : {0, 1, 10, 100, 1000}) {
+        // Exact-value expectations which never match.
+        Func exact{};
+        for (int i = 0; i < num_expectations; ++i) {
+            exact.make_expectation(-1 - i, 0);
+        }
+
+        BENCHMARK (scaled("exact values", "expectations", num_expectations)) {
+            exact(1, 1);
+        };
+
+        // General expectations which never match.
+        Func general{};
+        for (int i = 0; i < num_expectations; ++i) {
+            general.make_expectation(less_than(-i), 0);
+        }
+
+        BENCHMARK (scaled("matchers", "expectations", num_expectations)) {
+            general(1, 1);
+        };
+
+        // Expectations on an exact first argument, like one per message type,
+        // which never match.
+        Func keyed{};
+        for (int i = 0; i < num_expectations; ++i) {
+            keyed.make_expectation(i, less_than(0));
+        }
+
+        BENCHMARK (scaled("keyed", "expectations", num_expectations)) {
+            keyed(0, 1);
+        };
+    }
+}
+
+TEST_CASE ("Mock_Function::operator() absorbing calls") {
+    // The cost of a call through an interface, for comparison.
+    void (* volatile target)(int, int) = [] (int, int) {};
+    BENCHMARK ("indirect call") {
+        target(1, 1);
+    };
+
+    // No expectations: the call is counted without binding its arguments.
+    Func absorb{};
+    BENCHMARK ("no expectations") {
+        absorb(1, 1);
+    };
+
+    // A count-style call expectation matches every call.
+    Func expect{};
+    expect.expect_call(1, 1).at_least(0);
+    BENCHMARK ("call expectation") {
+        expect(1, 1);
+    };
+
+    // The same, shared between threads: counted without taking the lock.
+    Shared_Func shared{};
+    shared.expect_call(1, 1).at_least(0);
+    BENCHMARK ("call expectation, multi-threaded") {
+        shared(1, 1);
+    };
+}
+
+TEST_CASE ("Mock_Function::operator() consumed by an expectation") {
+    using c2mm::bench::scaled;
+
+    for (int num_expectations : {1, 10, 100, 1000}) {
+        BENCHMARK_ADVANCED (
+            scaled("consume each", "expectations", num_expectations)
+        ) (Catch::Benchmark::Chronometer meter) {
+            // Every run needs fresh expectations to consume.
+            std::vector<Func> funcs(meter.runs());
+            for (auto& func : funcs) {
+                for (int i = 0; i < num_expectations; ++i) {
+                    func.make_expectation(i, i);
+                }
+            }
+
+            meter.measure([&funcs, num_expectations] (int run) {
+                for (int i = 0; i < num_expectations; ++i) {
+                    funcs[run](int{i}, int{i});
+                }
+            });
+        };
+    }
+}
+
+namespace {
+using Fake = c2mm::mock::Mock_Function<
+    int(int, int),
+    c2mm::bench::Ignore,
+    c2mm::mock::storage::Counting
+>;
+
+int add (int lhs, int rhs) { return lhs + rhs; }
+}  // namespace
+
+TEST_CASE ("Mock_Function::operator() handled by an action") {
+    constexpr int num_calls = 100;
+
+    // The cost of the real function, called indirectly as through an
+    // interface.
+    BENCHMARK ("direct call") {
+        int (* volatile target)(int, int) = add;
+        int sum = 0;
+        for (int i = 0; i < num_calls; ++i) {
+            sum += target(i, i);
+        }
+        return sum;
+    };
+
+    // Every run needs fresh expectations to consume.
+    auto const measure = [] (
+        Catch::Benchmark::Chronometer meter,
+        auto const& set_action
+    ) {
+        std::vector<Fake> funcs(meter.runs());
+        for (auto& func : funcs) {
+            for (int i = 0; i < num_calls; ++i) {
+                set_action(func.make_expectation(i, i), i);
+            }
+        }
+
+        meter.measure([&funcs] (int run) {
+            int sum = 0;
+            for (int i = 0; i < num_calls; ++i) {
+                sum += funcs[run](int{i}, int{i});
+            }
+            return sum;
+        });
+    };
+
+    BENCHMARK_ADVANCED ("returns") (Catch::Benchmark::Chronometer meter) {
+        measure(meter, [] (auto handle, int i) { handle.returns(i + i); });
+    };
+
+    BENCHMARK_ADVANCED ("execute") (Catch::Benchmark::Chronometer meter) {
+        measure(meter, [] (auto handle, int) { handle.execute(add); });
+    };
+}
+
+TEST_CASE ("Mock_Function call verification vs. log size") {
+    using c2mm::bench::Ignore;
+    using c2mm::bench::scaled;
+    using c2mm::mock::Call_Order;
+
+    for (int num_calls : {10, 100, 1000, 10000}) {
+        // Verifying in reverse is the worst case for one call at a time.
+        std::vector<std::tuple<int, int>> expected{};
+        for (int i = num_calls - 1; i >= 0; --i) {
+            expected.emplace_back(i, i);
+        }
+
+        BENCHMARK_ADVANCED (
+            scaled("validate_called each", "calls", num_calls)
+        ) (Catch::Benchmark::Chronometer meter) {
+            auto funcs = logged_mocks(meter.runs(), num_calls);
+            meter.measure([&funcs, &expected] (int run) {
+                for (auto const& [a, b] : expected) {
+                    funcs[run].validate_called(Ignore{}, a, b);
+                }
+            });
+        };
+
+        BENCHMARK_ADVANCED (
+            scaled("validate_all_called", "calls", num_calls)
+        ) (Catch::Benchmark::Chronometer meter) {
+            auto funcs = logged_mocks(meter.runs(), num_calls);
+            meter.measure([&funcs, &expected] (int run) {
+                funcs[run].validate_all_called(
+                    Ignore{},
+                    Call_Order::any,
+                    expected
+                );
+            });
+        };
+    }
+}
+
+namespace {
+template <typename T_Capture>
+using Payload_Func = c2mm::mock::Mock_Function<
+    void(std::string const&),
+    c2mm::bench::Ignore,
+    c2mm::mock::storage::Heap,
+    c2mm::mock::threading::Single_Threaded,
+    T_Capture
+>;
+}  // namespace
+
+TEST_CASE ("Mock_Function logging a 1 MiB argument vs. capture policy") {
+    namespace capture = c2mm::mock::capture;
+    using c2mm::bench::Ignore;
+
+    std::string const payload(1 << 20, 'x');
+
+    // Each run logs one call then consumes it.
+    Payload_Func<capture::Value> value{};
+    BENCHMARK ("Value") {
+        value(payload);
+        value.validate_call_count(Ignore{}, 1);
+    };
+
+    Payload_Func<capture::Fingerprint> fingerprint{};
+    BENCHMARK ("Fingerprint") {
+        fingerprint(payload);
+        fingerprint.validate_call_count(Ignore{}, 1);
+    };
+
+    Payload_Func<capture::Project<[] (std::string const& text) {
+        return text.size();
+    }>> size{};
+    BENCHMARK ("Project (size)") {
+        size(payload);
+        size.validate_call_count(Ignore{}, 1);
+    };
+
+    Payload_Func<capture::Drop> drop{};
+    BENCHMARK ("Drop") {
+        drop(payload);
+        drop.validate_call_count(Ignore{}, 1);
+    };
+}
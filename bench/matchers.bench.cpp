@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/Range_Matchers.hpp"
+#include "c2mm/matchers/Tuple_Matcher.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/cx/Tuple.hpp"
+
+TEST_CASE ("Tuple_Matcher::match vs. arity") {
+    using c2mm::matchers::less_than;
+    using c2mm::matchers::matches;
+
+    // Values match so that every constraint is evaluated.
+    auto const m1 = matches(std::tuple{1});
+    auto const m2 = matches(std::tuple{1, less_than(3)});
+    auto const m4 = matches(std::tuple{1, less_than(3), 3, less_than(5)});
+    auto const m8 = matches(std::tuple{
+        1, less_than(3), 3, less_than(5),
+        5, less_than(7), 7, less_than(9),
+    });
+
+    int a = 1;
+    BENCHMARK ("match (arity = 1)") {
+        return m1.match(std::tie(a));
+    };
+    BENCHMARK ("match (arity = 2)") {
+        return m2.match(std::tuple{a, 2});
+    };
+    BENCHMARK ("match (arity = 4)") {
+        return m4.match(std::tuple{a, 2, 3, 4});
+    };
+    BENCHMARK ("match (arity = 8)") {
+        return m8.match(std::tuple{a, 2, 3, 4, 5, 6, 7, 8});
+    };
+
+    // The same constraints as constexpr matchers.
+    namespace cx = c2mm::matchers::cx;
+    auto const cx8 = cx::tuple(
+        1, cx::less_than(3), 3, cx::less_than(5),
+        5, cx::less_than(7), 7, cx::less_than(9)
+    );
+    BENCHMARK ("match (arity = 8, constexpr)") {
+        return cx8.match(std::tuple{a, 2, 3, 4, 5, 6, 7, 8});
+    };
+
+    // The first constraint rejects.
+    int b = 0;
+    BENCHMARK ("mismatch first (arity = 8)") {
+        return m8.match(std::tuple{b, 2, 3, 4, 5, 6, 7, 8});
+    };
+}
+
+TEST_CASE ("Tuple_Matcher::match vs. evaluation order") {
+    using c2mm::matchers::Evaluation_Order;
+    using c2mm::matchers::matches;
+
+    // Only the cheap, last constraint rejects.
+    std::string const text(64, 'x');
+    auto const declared = matches(std::tuple{text, text, 1});
+    auto const cheapest_first = matches<Evaluation_Order::cheapest_first>(
+        std::tuple{text, text, 1}
+    );
+
+    auto const values = std::tuple{text, text, 0};
+    BENCHMARK ("mismatch last (declared)") {
+        return declared.match(values);
+    };
+    BENCHMARK ("mismatch last (cheapest_first)") {
+        return cheapest_first.match(values);
+    };
+}
+
+TEST_CASE ("Comparison_Matcher construction") {
+    using namespace c2mm::matchers;
+
+    BENCHMARK ("equal_to(int)") {
+        return equal_to(42);
+    };
+    BENCHMARK ("less_than(double)") {
+        return less_than(4.2);
+    };
+    BENCHMARK ("greater_or_equal_to(int)") {
+        return greater_or_equal_to(-7);
+    };
+}
+
+TEST_CASE ("Range matchers vs. element-by-element loops") {
+    namespace cx = c2mm::matchers::cx;
+    using namespace c2mm::matchers;
+
+    // Every element matches so that the whole range is scanned. The samples
+    // are clobbered before each run so that the scan cannot be hoisted.
+    std::vector<float> samples(4096, 0.25f);
+    std::vector<float> const reference(4096, 0.5f);
+    auto const clobber = [&] {
+        Catch::Benchmark::keep_memory(samples.data());
+    };
+
+    BENCHMARK ("all_less_than (4096 floats, loop)") {
+        clobber();
+        return std::ranges::all_of(samples, cx::less_than(1.0f));
+    };
+    BENCHMARK ("all_less_than (4096 floats, simd)") {
+        clobber();
+        return all_less_than(1.0f).match(samples);
+    };
+
+    BENCHMARK ("all_within (4096 floats, loop)") {
+        clobber();
+        return std::ranges::all_of(samples, cx::within(0.0f, 1.0f));
+    };
+    BENCHMARK ("all_within (4096 floats, simd)") {
+        clobber();
+        return all_within(0.0f, 1.0f).match(samples);
+    };
+
+    auto const bounded = max_abs_diff_within(std::span{reference}, 0.5f);
+    BENCHMARK ("max_abs_diff_within (4096 floats, loop)") {
+        clobber();
+        return std::ranges::equal(
+            samples,
+            reference,
+            cx::Within_Tolerance<float>{0.5f}
+        );
+    };
+    BENCHMARK ("max_abs_diff_within (4096 floats, simd)") {
+        clobber();
+        return bounded.match(samples);
+    };
+}
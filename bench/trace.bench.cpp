@@ -0,0 +1,61 @@
+#include "c2mm/mock/trace/Trace.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/mock/Mock_Function.hpp"
+#include "c2mm/mock/trace/Writer.hpp"
+
+#include "utils.hpp"
+
+namespace {
+using Signature = void(std::string const&, int);
+
+// Stands in for the production code behind a mocked interface.
+class Word_Counter {
+  public:
+    void operator () (std::string const& word, int count) {
+        counts_[word] += count;
+    }
+
+    std::size_t size () const { return counts_.size(); }
+
+  private:
+    std::unordered_map<std::string, int> counts_{};
+};
+}  // namespace
+
+TEST_CASE ("Replaying a recorded mock trace into a real implementation") {
+    using namespace c2mm::mock::trace;
+
+    auto const path =
+        std::filesystem::temp_directory_path() / "c2mm-trace.bench.bin";
+
+    // The "test": drive a mock and record everything it sees.
+    {
+        Writer<Signature> writer{path};
+        c2mm::mock::Mock_Function<Signature, c2mm::bench::Ignore> func{};
+        func.record(writer);
+
+        constexpr std::string_view words[] = {"alpha", "beta", "gamma"};
+        for (int i = 0; i < 10000; ++i) {
+            func(std::string{words[i % 3]} + std::to_string(i % 97), int{i});
+        }
+        func.check_call_count(10000);
+    }
+
+    Trace<Signature> const trace{path};
+    std::filesystem::remove(path);
+
+    BENCHMARK ("replay 10000 calls into Word_Counter") {
+        Word_Counter counter{};
+        replay(trace, counter);
+        return counter.size();
+    };
+}
@@ -0,0 +1,33 @@
+#ifndef C2MM_BENCH__UTILS_HPP_
+#define C2MM_BENCH__UTILS_HPP_
+
+#include <string>
+#include <string_view>
+
+namespace c2mm::bench {
+/**
+ * A reporter policy which ignores failures. Benchmarks leave calls unconsumed
+ * on purpose.
+ */
+struct Ignore {
+    void operator () (std::string_view) const {}
+};
+
+/**
+ * Name a benchmark run for one value of a scaling parameter.
+ * @param[in] name Name of the operation being measured.
+ * @param[in] param Name of the scaling parameter.
+ * @param[in] value Value of the scaling parameter.
+ * @return The combined name, e.g. `"log (calls = 100)"`.
+ */
+inline std::string scaled (
+    std::string_view name,
+    std::string_view param,
+    long long value
+) {
+    return std::string{name} + " (" + std::string{param} + " = " +
+        std::to_string(value) + ")";
+}
+}  // namespace c2mm::bench
+
+#endif  // C2MM_BENCH__UTILS_HPP_
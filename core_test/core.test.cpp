@@ -0,0 +1,113 @@
+#include "c2mm/core.hpp"
+
+#ifndef C2MM_NO_CATCH2
+#error "The core tests must be built against the c2mm::core target."
+#endif
+
+// The core headers must stay usable without Catch2, so none of them may
+// include it, even indirectly.
+#if defined(CATCH_TEST_MACROS_HPP_INCLUDED) or \
+    defined(CATCH_MATCHERS_HPP_INCLUDED) or \
+    defined(CATCH_TOSTRING_HPP_INCLUDED)
+#error "c2mm/core.hpp includes Catch2."
+#endif
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+SCENARIO ("The core of c2mm reports failures without Catch2.") {
+    using c2mm::mock::Call_Log;
+    using Reporter = c2mm::mock::reporters::Throws<std::runtime_error>;
+    using Storage = c2mm::mock::threading::Multi_Threaded<>::Log_Storage<
+        c2mm::mock::storage::Heap
+    >;
+
+    GIVEN ("a Call_Log which throws on failure") {
+        Call_Log<std::tuple<int, std::string>, Reporter, Storage> log{};
+
+        WHEN ("a logged call is consumed") {
+            log.log(1, "one");
+            log.consume_if([] (auto const& call) {
+                return std::get<0>(call) == 1;
+            });
+
+            THEN ("nothing is reported") {
+                CHECK_NOTHROW(log.check_no_calls());
+            }
+        }
+
+        WHEN ("a logged call is never consumed") {
+            log.log(2, "two");
+
+            THEN ("checking for calls throws") {
+                CHECK_THROWS_AS(log.check_no_calls(), std::runtime_error);
+            }
+        }
+    }
+}
+
+SCENARIO ("Mock functions of the core report failures without Catch2.") {
+    using c2mm::matchers::equal_to;
+    using c2mm::matchers::greater_than;
+    using Reporter = c2mm::mock::reporters::Throws<std::runtime_error>;
+
+    GIVEN ("a mock function which throws on failure") {
+        // Failures reported while destroying the mock would terminate, so
+        // the expectation is satisfied whether or not it is called.
+        c2mm::mock::Mock_Function<int(int), Reporter> func{};
+        func.make_expectation(equal_to(1))
+            .at_most(1)
+            .execute([] (int value) { return value * 10; });
+
+        WHEN ("it is called as expected") {
+            int const result = func(1);
+
+            THEN ("the expectation's action runs") {
+                CHECK(result == 10);
+                CHECK_NOTHROW(func.validate_call_count(Reporter{}, 0));
+            }
+        }
+
+        WHEN ("it is called otherwise") {
+            func(5);
+
+            THEN ("the call is logged and can be verified") {
+                CHECK_THROWS_AS(
+                    func.validate_called(Reporter{}, equal_to(4)),
+                    std::runtime_error
+                );
+                CHECK_NOTHROW(
+                    func.validate_called(Reporter{}, greater_than(4))
+                );
+                CHECK_NOTHROW(func.validate_call_count(Reporter{}, 0));
+            }
+        }
+
+        WHEN ("a call is left unverified") {
+            func(7);
+
+            THEN ("it is reported by the call log's reporter") {
+                CHECK_THROWS_AS(
+                    func.validate_call_count(Reporter{}, 0),
+                    std::runtime_error
+                );
+            }
+        }
+    }
+}
+
+TEST_CASE ("The core describes values without Catch2.") {
+    using c2mm::matchers::equal_to;
+    using c2mm::matchers::greater_than;
+    using c2mm::matchers::utils::describe;
+
+    CHECK(greater_than(4).toString() == "> 4");
+    CHECK(equal_to(std::string{"four"}).toString() == "== \"four\"");
+    CHECK(describe('4') == "'4'");
+    CHECK(describe(std::vector{1, 2}) == "{ 1, 2 }");
+    CHECK(describe(true) == "true");
+}
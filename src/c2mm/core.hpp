@@ -0,0 +1,76 @@
+#ifndef C2MM__CORE_HPP_
+#define C2MM__CORE_HPP_
+
+// Every header of c2mm which can be used without Catch2, for fakes linked into
+// load tests and service harnesses through the `c2mm::core` target.
+//
+// They only stay free of Catch2 when @c C2MM_NO_CATCH2 is defined, which the
+// `c2mm::core` target does. Matchers are then built on stand-ins for Catch2's
+// matcher classes and describe values without Catch2's @c StringMaker, and
+// the mocks' Catch2-style verifications, such as @c check_called, do not
+// compile. Outside of Catch2 tests, failures are reported with a reporter
+// such as @c reporters::Throws instead. Code built with the macro must not be
+// linked with code built without it.
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/Inline_Matcher.hpp"
+#include "c2mm/matchers/Match_Cost.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
+#include "c2mm/matchers/Predicate_Description.hpp"
+#include "c2mm/matchers/Range_Matchers.hpp"
+#include "c2mm/matchers/Tuple_Matcher.hpp"
+#include "c2mm/matchers/Typed_Wrapper.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/cx/Tuple.hpp"
+#include "c2mm/matchers/cx/utils.hpp"
+#include "c2mm/matchers/simd/kernels.hpp"
+#include "c2mm/matchers/utils.hpp"
+#include "c2mm/mock/Arg_Hasher.hpp"
+#include "c2mm/mock/Async_Expectation.hpp"
+#include "c2mm/mock/Async_Mock_Function.hpp"
+#include "c2mm/mock/Call_Expectation.hpp"
+#include "c2mm/mock/Call_Log.hpp"
+#include "c2mm/mock/Cardinality.hpp"
+#include "c2mm/mock/Default_Action.hpp"
+#include "c2mm/mock/Dispatch_Table.hpp"
+#include "c2mm/mock/Expectation.hpp"
+#include "c2mm/mock/Expectation_Handle.hpp"
+#include "c2mm/mock/Expectation_Set.hpp"
+#include "c2mm/mock/Inline_Action.hpp"
+#include "c2mm/mock/Mock_Function.hpp"
+#include "c2mm/mock/Pending_Call.hpp"
+#include "c2mm/mock/Serializer.hpp"
+#include "c2mm/mock/actions.hpp"
+#include "c2mm/mock/args.hpp"
+#include "c2mm/mock/capture/Drop.hpp"
+#include "c2mm/mock/capture/Fingerprint.hpp"
+#include "c2mm/mock/capture/Per_Parameter.hpp"
+#include "c2mm/mock/capture/Project.hpp"
+#include "c2mm/mock/capture/Value.hpp"
+#include "c2mm/mock/reporters/Mock.hpp"
+#include "c2mm/mock/reporters/Throws.hpp"
+#include "c2mm/mock/stats/Counters.hpp"
+#include "c2mm/mock/stats/None.hpp"
+#include "c2mm/mock/stats/Registry.hpp"
+#include "c2mm/mock/stats/Statistics.hpp"
+#include "c2mm/mock/stats/json.hpp"
+#include "c2mm/mock/storage/Chunked.hpp"
+#include "c2mm/mock/storage/Counting.hpp"
+#include "c2mm/mock/storage/Heap.hpp"
+// Memory-mapped storage needs POSIX.
+#if __has_include(<sys/mman.h>) and __has_include(<unistd.h>)
+#include "c2mm/mock/storage/Mapped.hpp"
+#endif
+#include "c2mm/mock/storage/Ring.hpp"
+#include "c2mm/mock/storage/Sharded.hpp"
+#include "c2mm/mock/threading/Call_Signal.hpp"
+#include "c2mm/mock/threading/Multi_Threaded.hpp"
+#include "c2mm/mock/threading/Single_Threaded.hpp"
+#include "c2mm/mock/trace/Trace.hpp"
+#include "c2mm/mock/trace/Writer.hpp"
+#include "c2mm/mock/trace/format.hpp"
+#include "c2mm/mp/all.hpp"
+#include "c2mm/mp/utils.hpp"
+#include "c2mm/mp/zip_with.hpp"
+
+#endif  // C2MM__CORE_HPP_
@@ -1,19 +1,33 @@
 #ifndef C2MM__MATCHERS__COMPARISON_MATCHER_HPP_
 #define C2MM__MATCHERS__COMPARISON_MATCHER_HPP_
 
+#include <concepts>
 #include <functional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
-#include <catch2/catch_tostring.hpp>
-#include <catch2/matchers/catch_matchers_templated.hpp>
+#include "c2mm/matchers/Match_Cost.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
+#include "c2mm/matchers/Predicate_Description.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/utils.hpp"
 
 namespace c2mm::matchers {
 /**
  * Matcher comparing to an expected value using a binary predicate.
  *
  * This is similar to @c Catch::Matchers::PredicateMatcher except it helps
- * generate the description based on the expected value.
+ * generate the description based on the expected value. The comparison itself
+ * is delegated to a @c cx::Comparison.
+ *
+ * A description of the predicate given as a @c std::string_view is not
+ * copied, so constructing a matcher from a static description never allocates
+ * unless copying the expected value does. A description given as a @c
+ * std::string is copied or moved into the matcher instead. The full
+ * description is only formatted when @c describe is called.
  *
  * @tparam T_Expected The type of the expected value.
  * @tparam T_Binary_Pred A binary predicate callable. Must support the following
@@ -21,24 +35,74 @@ namespace c2mm::matchers {
  *     passed to `match(value)`.
  */
 template <typename T_Expected, typename T_Binary_Pred>
-class Comparison_Matcher final : public Catch::Matchers::MatcherGenericBase {
+class Comparison_Matcher final : public Generic_Matcher_Base {
   public:
+    /**
+     * Construct with the @c Predicate_Description of @p T_Binary_Pred.
+     * @param[in] expected The value expected by the matcher.
+     */
+    template <typename T>
+        requires (
+            not std::is_same_v<std::remove_cvref_t<T>, Comparison_Matcher>
+        )
+    explicit Comparison_Matcher (T&& expected)
+          : Comparison_Matcher{
+                std::forward<T>(expected),
+                Predicate_Description<T_Binary_Pred>::value
+            }
+    {}
+
     /**
      * Construct from required components.
      * @param[in] expected The value expected by the matcher.
-     * @param[in] pred_description Description of the predicate.
+     * @param[in] pred_description Description of the predicate. Not copied, so
+     *     it must outlive the matcher.
      * @param[in] predicate A callable to compare a value against @p expected.
      */
     template <typename T>
     Comparison_Matcher (
         T&& expected,
-        std::string pred_description,
+        std::string_view pred_description,
         T_Binary_Pred predicate = T_Binary_Pred{}
-    ) : expected_{std::forward<T>(expected)},
-        pred_description_{std::move(pred_description)},
-        predicate_{std::move(predicate)}
+    ) : comparison_{std::forward<T>(expected), std::move(predicate)},
+        pred_description_{pred_description}
     {}
 
+    /**
+     * Construct from required components, keeping a copy of a description of
+     * the predicate which might not outlive the matcher.
+     * @param[in] expected The value expected by the matcher.
+     * @param[in] pred_description Description of the predicate, e.g. one
+     *     formatted at runtime. Copied, or moved if it is an rvalue.
+     * @param[in] predicate A callable to compare a value against @p expected.
+     */
+    template <typename T, typename T_Description>
+        requires std::same_as<std::remove_cvref_t<T_Description>, std::string>
+    Comparison_Matcher (
+        T&& expected,
+        T_Description&& pred_description,
+        T_Binary_Pred predicate = T_Binary_Pred{}
+    ) : comparison_{std::forward<T>(expected), std::move(predicate)},
+        pred_description_{
+            std::in_place_type<std::string>,
+            std::forward<T_Description>(pred_description)
+        }
+    {}
+
+    /**
+     * Read-only accessor for the expected value.
+     * @return Constant reference to the @c expected field.
+     */
+    T_Expected const& expected () const { return comparison_.expected(); }
+
+    /**
+     * Read-only accessor for the underlying constexpr comparison.
+     * @return Constant reference to the @c comparison field.
+     */
+    cx::Comparison<T_Expected, T_Binary_Pred> const& comparison () const {
+        return comparison_;
+    }
+
     /**
      * Execute the predicate to compare @p value against the stored @c expected.
      * @param[in] value The value to compare.
@@ -46,7 +110,7 @@ class Comparison_Matcher final : public Catch::Matchers::MatcherGenericBase {
      */
     template <typename T>
     bool match (T const& value) const {
-        return predicate_(value, expected_);
+        return comparison_.match(value);
     }
 
     /**
@@ -55,15 +119,29 @@ class Comparison_Matcher final : public Catch::Matchers::MatcherGenericBase {
      *     value.
      */
     std::string describe () const override {
-        return pred_description_ + ::Catch::Detail::stringify(expected_);
+        return utils::describe_comparison(
+            std::visit(
+                [] (auto const& pred) -> std::string_view { return pred; },
+                pred_description_
+            ),
+            comparison_.predicate(),
+            expected()
+        );
     }
 
   private:
-    T_Expected expected_;
-    std::string pred_description_;
-    T_Binary_Pred predicate_;
+    cx::Comparison<T_Expected, T_Binary_Pred> comparison_;
+    std::variant<std::string_view, std::string> pred_description_;
 };
 
+/**
+ * Comparing against an expected value costs the same as comparing to it
+ * directly.
+ */
+template <typename T_Expected, typename T_Binary_Pred>
+struct Match_Cost<Comparison_Matcher<T_Expected, T_Binary_Pred>>
+      : Match_Cost<T_Expected> {};
+
 /**
  * Create a matcher to check for exact equality with @p expected.
  * @param[in] expected The expected value. Used as the second argument in the
@@ -73,7 +151,10 @@ class Comparison_Matcher final : public Catch::Matchers::MatcherGenericBase {
 template <typename T>
 Comparison_Matcher<std::remove_cvref_t<T>, std::equal_to<>>
 equal_to (T&& expected) {
-    return {std::forward<T>(expected), "== "};
+    return {
+        std::forward<T>(expected),
+        Predicate_Description<std::equal_to<>>::value
+    };
 }
 
 /**
@@ -85,7 +166,10 @@ equal_to (T&& expected) {
 template <typename T>
 Comparison_Matcher<std::remove_cvref_t<T>, std::not_equal_to<>>
 not_equal_to (T&& expected) {
-    return {std::forward<T>(expected), "!= "};
+    return {
+        std::forward<T>(expected),
+        Predicate_Description<std::not_equal_to<>>::value
+    };
 }
 
 /**
@@ -97,7 +181,10 @@ not_equal_to (T&& expected) {
 template <typename T>
 Comparison_Matcher<std::remove_cvref_t<T>, std::greater<>>
 greater_than (T&& expected) {
-    return {std::forward<T>(expected), "> "};
+    return {
+        std::forward<T>(expected),
+        Predicate_Description<std::greater<>>::value
+    };
 }
 
 /**
@@ -109,7 +196,10 @@ greater_than (T&& expected) {
 template <typename T>
 Comparison_Matcher<std::remove_cvref_t<T>, std::less<>>
 less_than (T&& expected) {
-    return {std::forward<T>(expected), "< "};
+    return {
+        std::forward<T>(expected),
+        Predicate_Description<std::less<>>::value
+    };
 }
 
 /**
@@ -123,7 +213,10 @@ less_than (T&& expected) {
 template <typename T>
 Comparison_Matcher<std::remove_cvref_t<T>, std::greater_equal<>>
 greater_or_equal_to (T&& expected) {
-    return {std::forward<T>(expected), ">= "};
+    return {
+        std::forward<T>(expected),
+        Predicate_Description<std::greater_equal<>>::value
+    };
 }
 
 /**
@@ -135,7 +228,32 @@ greater_or_equal_to (T&& expected) {
 template <typename T>
 Comparison_Matcher<std::remove_cvref_t<T>, std::less_equal<>>
 less_or_equal_to (T&& expected) {
-    return {std::forward<T>(expected), "<= "};
+    return {
+        std::forward<T>(expected),
+        Predicate_Description<std::less_equal<>>::value
+    };
+}
+
+/**
+ * Create a matcher to check that values are within @p tolerance of @p
+ * expected.
+ * @param[in] expected The expected value. Used as the second argument in the
+ *     comparison.
+ * @param[in] tolerance The largest accepted absolute difference.
+ * @return A matcher to check if values are within @p tolerance of @p expected.
+ */
+template <typename T, typename T_Tolerance>
+Comparison_Matcher<
+    std::remove_cvref_t<T>,
+    cx::Within_Tolerance<std::remove_cvref_t<T_Tolerance>>
+>
+within (T&& expected, T_Tolerance&& tolerance) {
+    using Predicate = cx::Within_Tolerance<std::remove_cvref_t<T_Tolerance>>;
+    return {
+        std::forward<T>(expected),
+        Predicate_Description<Predicate>::value,
+        Predicate{std::forward<T_Tolerance>(tolerance)}
+    };
 }
 }  // namespace c2mm::matchers
 
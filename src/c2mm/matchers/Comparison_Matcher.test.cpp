@@ -1,8 +1,13 @@
 #include "c2mm/matchers/Comparison_Matcher.hpp"
 
+#include <functional>
+#include <string>
+
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_templated.hpp>
 
 // TODO(emery): Test class Comparison_Matcher with a mock function.
 
@@ -39,3 +44,84 @@ TEST_CASE ("class c2mm::matchers::Comparison_Matcher - less_than(int)") {
         CHECK(matcher.match(value) == result);
     }
 }
+
+TEST_CASE ("class c2mm::matchers::Comparison_Matcher - descriptions") {
+    using c2mm::matchers::Comparison_Matcher;
+
+    SECTION ("each factory describes its predicate") {
+        using namespace c2mm::matchers;
+        CHECK(equal_to(1).describe() == "== 1");
+        CHECK(not_equal_to(1).describe() == "!= 1");
+        CHECK(greater_than(1).describe() == "> 1");
+        CHECK(less_than(1).describe() == "< 1");
+        CHECK(greater_or_equal_to(1).describe() == ">= 1");
+        CHECK(less_or_equal_to(1).describe() == "<= 1");
+        CHECK(within(1, 2).describe() == "within 2 of 1");
+    }
+
+    SECTION ("the predicate description defaults to its static description") {
+        Comparison_Matcher<int, std::greater<>> const matcher{3};
+        CHECK(matcher.describe() == "> 3");
+    }
+
+    SECTION ("a custom predicate can be described") {
+        auto const divides = [] (int value, int expected) {
+            return value % expected == 0;
+        };
+        Comparison_Matcher<int, decltype(divides)> const matcher{
+            4,
+            "divisible by ",
+            divides,
+        };
+        CHECK(matcher.match(12));
+        CHECK(not matcher.match(13));
+        CHECK(matcher.describe() == "divisible by 4");
+    }
+
+    SECTION ("a description formatted at runtime is kept") {
+        auto const divides = [] (int value, int expected) {
+            return value % expected == 0;
+        };
+        std::string const name{"divisible"};
+        Comparison_Matcher<int, decltype(divides)> const matcher{
+            4,
+            name + " by ",
+            divides,
+        };
+        auto const copy = matcher;
+        CHECK(matcher.describe() == "divisible by 4");
+        CHECK(copy.describe() == "divisible by 4");
+    }
+
+    SECTION ("a description which goes out of scope is copied") {
+        auto const divides = [] (int value, int expected) {
+            return value % expected == 0;
+        };
+        auto const make_matcher = [&divides] {
+            std::string const description{"divisible by "};
+            return Comparison_Matcher<int, decltype(divides)>{
+                4,
+                description,
+                divides,
+            };
+        };
+        auto const matcher = make_matcher();
+        CHECK(matcher.describe() == "divisible by 4");
+    }
+
+    SECTION ("copies are independent") {
+        auto original = c2mm::matchers::less_than(5);
+        auto copy = original;
+        CHECK(copy.describe() == "< 5");
+        CHECK(copy.expected() == 5);
+    }
+}
+
+TEST_CASE ("class c2mm::matchers::Comparison_Matcher - Catch2 operators") {
+    using c2mm::matchers::greater_than;
+    using c2mm::matchers::less_than;
+
+    CHECK_THAT(3, greater_than(1) && less_than(5));
+    CHECK_THAT(7, less_than(1) || greater_than(5));
+    CHECK_THAT(7, !less_than(5));
+}
@@ -0,0 +1,245 @@
+#ifndef C2MM__MATCHERS__INLINE_MATCHER_HPP_
+#define C2MM__MATCHERS__INLINE_MATCHER_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/Matcher_Base.hpp"
+
+namespace c2mm::matchers {
+/**
+ * Owns a typed matcher of any concrete type without allocating.
+ *
+ * Any matcher deriving from @c Matcher_Base<T_Actual> can be stored. If it
+ * fits in @p t_capacity bytes it is stored inline. Otherwise it falls back to
+ * an allocation from a memory resource, by default @c
+ * std::pmr::get_default_resource().
+ *
+ * The concrete type is erased with a table of function pointers rather than
+ * the matcher's own virtual functions. @c match calls the concrete @c match
+ * directly so the whole comparison can be inlined behind a single indirect
+ * call.
+ *
+ * @tparam T_Actual Type of value to match.
+ * @tparam t_capacity Size of the inline buffer in bytes.
+ */
+template <typename T_Actual, std::size_t t_capacity = 192>
+class Inline_Matcher {
+  public:
+    using Base = Matcher_Base<T_Actual>;
+
+    /**
+     * Take ownership of @p matcher.
+     *
+     * This constructor is intentionally not @c explicit.
+     *
+     * @param[in] matcher The matcher to store.
+     */
+    template <typename T_Matcher>
+        requires std::derived_from<std::remove_cvref_t<T_Matcher>, Base>
+    Inline_Matcher (T_Matcher&& matcher)
+          : Inline_Matcher{
+                std::allocator_arg,
+                std::pmr::get_default_resource(),
+                std::forward<T_Matcher>(matcher)
+            } {}
+
+    /**
+     * Take ownership of @p matcher, allocating from @p resource if it does not
+     * fit inline.
+     *
+     * @param[in] resource Memory resource for the fallback allocation. Must
+     *     outlive this object.
+     * @param[in] matcher The matcher to store.
+     */
+    template <typename T_Matcher>
+        requires std::derived_from<std::remove_cvref_t<T_Matcher>, Base>
+    Inline_Matcher (
+        std::allocator_arg_t,
+        std::pmr::memory_resource* resource,
+        T_Matcher&& matcher
+    ) {
+        using Matcher = std::remove_cvref_t<T_Matcher>;
+
+        if constexpr (fits_inline<Matcher>) {
+            ::new (static_cast<void*>(storage_))
+                Matcher(std::forward<T_Matcher>(matcher));
+            vtable_ = &inline_vtable<Matcher>;
+        } else {
+            std::pmr::polymorphic_allocator<> allocator{resource};
+            ::new (static_cast<void*>(storage_)) Allocated<Matcher>{
+                allocator.new_object<Matcher>(
+                    std::forward<T_Matcher>(matcher)
+                ),
+                resource,
+            };
+            vtable_ = &allocated_vtable<Matcher>;
+        }
+    }
+
+    /**
+     * Take ownership of a matcher which is already on the heap. Unless @p
+     * T_Matcher is @c final, matching goes through its virtual @c match.
+     *
+     * This constructor is intentionally not @c explicit.
+     *
+     * @param[in] matcher The matcher to adopt. Must not be null.
+     */
+    template <typename T_Matcher>
+        requires std::derived_from<T_Matcher, Base>
+    Inline_Matcher (std::unique_ptr<T_Matcher> matcher) {
+        ::new (static_cast<void*>(storage_)) T_Matcher*(matcher.release());
+        vtable_ = &heap_vtable<T_Matcher, std::is_final_v<T_Matcher>>;
+    }
+
+    Inline_Matcher (Inline_Matcher&& other) : vtable_{other.vtable_} {
+        vtable_->relocate(storage_, other.storage_);
+        other.vtable_ = nullptr;
+    }
+
+    Inline_Matcher (Inline_Matcher const&) = delete;
+    Inline_Matcher& operator = (Inline_Matcher const&) = delete;
+    Inline_Matcher& operator = (Inline_Matcher&&) = delete;
+
+    ~Inline_Matcher () {
+        if (vtable_) {
+            vtable_->destroy(storage_);
+        }
+    }
+
+    /**
+     * Access the stored matcher through its base class, e.g. to describe it.
+     * @return Constant reference to the stored matcher.
+     */
+    Base const& base () const {
+        return vtable_->base(storage_);
+    }
+
+    /**
+     * Match @p value against the stored matcher.
+     * @param[in] value The value to match.
+     * @return The result of the stored matcher's @c match.
+     */
+    bool match (T_Actual const& value) const {
+        return vtable_->match(storage_, value);
+    }
+
+  private:
+    struct VTable {
+        bool (*match)(void const*, T_Actual const&);
+        Base const& (*base)(void const*);
+        void (*relocate)(void*, void*);
+        void (*destroy)(void*);
+    };
+
+    template <typename T_Matcher>
+    static constexpr bool fits_inline =
+        sizeof(T_Matcher) <= t_capacity and
+        alignof(T_Matcher) <= alignof(std::max_align_t) and
+        std::is_nothrow_move_constructible_v<T_Matcher>;
+
+    // A matcher allocated from a memory resource, which is needed again to
+    // free it.
+    template <typename T_Matcher>
+    struct Allocated {
+        T_Matcher* matcher;
+        std::pmr::memory_resource* resource;
+    };
+
+    static_assert(sizeof(Allocated<Base>) <= t_capacity);
+
+    template <typename T_Matcher>
+    static T_Matcher const& get_inline (void const* storage) {
+        return *std::launder(static_cast<T_Matcher const*>(storage));
+    }
+
+    template <typename T_Matcher>
+    static T_Matcher* get_heap (void const* storage) {
+        return *std::launder(static_cast<T_Matcher* const*>(storage));
+    }
+
+    // A qualified call to `match` bypasses virtual dispatch. Only valid when
+    // `T_Matcher` is the dynamic type of `matcher`.
+    template <typename T_Matcher, bool t_exact_type>
+    static bool call_match (T_Matcher const& matcher, T_Actual const& value) {
+        if constexpr (t_exact_type) {
+            return matcher.T_Matcher::match(value);
+        } else {
+            return matcher.match(value);
+        }
+    }
+
+    template <typename T_Matcher>
+    static constexpr VTable inline_vtable{
+        [] (void const* storage, T_Actual const& value) {
+            return call_match<T_Matcher, true>(
+                get_inline<T_Matcher>(storage),
+                value
+            );
+        },
+        [] (void const* storage) -> Base const& {
+            return get_inline<T_Matcher>(storage);
+        },
+        [] (void* dst, void* src) {
+            auto& source = *std::launder(static_cast<T_Matcher*>(src));
+            ::new (dst) T_Matcher(std::move(source));
+            source.~T_Matcher();
+        },
+        [] (void* storage) {
+            std::launder(static_cast<T_Matcher*>(storage))->~T_Matcher();
+        },
+    };
+
+    template <typename T_Matcher, bool t_exact_type>
+    static constexpr VTable heap_vtable{
+        [] (void const* storage, T_Actual const& value) {
+            return call_match<T_Matcher, t_exact_type>(
+                *get_heap<T_Matcher>(storage),
+                value
+            );
+        },
+        [] (void const* storage) -> Base const& {
+            return *get_heap<T_Matcher>(storage);
+        },
+        [] (void* dst, void* src) {
+            ::new (dst) T_Matcher*(get_heap<T_Matcher>(src));
+        },
+        [] (void* storage) {
+            delete get_heap<T_Matcher>(storage);
+        },
+    };
+
+    template <typename T_Matcher>
+    static constexpr VTable allocated_vtable{
+        [] (void const* storage, T_Actual const& value) {
+            return call_match<T_Matcher, true>(
+                *get_inline<Allocated<T_Matcher>>(storage).matcher,
+                value
+            );
+        },
+        [] (void const* storage) -> Base const& {
+            return *get_inline<Allocated<T_Matcher>>(storage).matcher;
+        },
+        [] (void* dst, void* src) {
+            ::new (dst) Allocated<T_Matcher>(
+                get_inline<Allocated<T_Matcher>>(src)
+            );
+        },
+        [] (void* storage) {
+            auto const& allocated = get_inline<Allocated<T_Matcher>>(storage);
+            std::pmr::polymorphic_allocator<>{allocated.resource}
+                .delete_object(allocated.matcher);
+        },
+    };
+
+    alignas(std::max_align_t) std::byte storage_[t_capacity];
+    VTable const* vtable_;
+};
+}  // namespace c2mm::matchers
+
+#endif  // C2MM__MATCHERS__INLINE_MATCHER_HPP_
@@ -0,0 +1,115 @@
+#include "c2mm/matchers/Inline_Matcher.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/Tuple_Matcher.hpp"
+#include "c2mm/matchers/Typed_Wrapper.hpp"
+
+SCENARIO ("matchers::Inline_Matcher stores a typed matcher") {
+    using c2mm::matchers::Inline_Matcher;
+    using c2mm::matchers::less_than;
+    using c2mm::matchers::matches;
+    using c2mm::matchers::wrap_for;
+    using Args = std::tuple<int, double>;
+
+    GIVEN ("a matcher which fits inline") {
+        Inline_Matcher<Args> matcher{
+            wrap_for<Args>(matches(std::tuple{7, less_than(3.5)}))
+        };
+
+        THEN ("it matches like the original") {
+            CHECK(matcher.match(Args{7, 3.0}));
+            CHECK(not matcher.match(Args{7, 4.0}));
+            CHECK(not matcher.match(Args{6, 3.0}));
+        }
+
+        THEN ("the stored matcher is inside the object") {
+            auto const* base = &matcher.base();
+            auto const* self = reinterpret_cast<std::byte const*>(&matcher);
+            CHECK(reinterpret_cast<std::byte const*>(base) >= self);
+            CHECK(reinterpret_cast<std::byte const*>(base)
+                < self + sizeof(matcher));
+        }
+
+        WHEN ("it is moved") {
+            Inline_Matcher<Args> moved{std::move(matcher)};
+
+            THEN ("the new object matches like the original") {
+                CHECK(moved.match(Args{7, 3.0}));
+                CHECK(not moved.match(Args{6, 3.0}));
+            }
+        }
+    }
+
+    GIVEN ("a matcher too large to fit inline") {
+        std::array<int, 64> const expected{};
+        Inline_Matcher<std::tuple<std::array<int, 64>>, 16> matcher{
+            wrap_for<std::tuple<std::array<int, 64>>>(
+                matches(std::tuple{expected})
+            )
+        };
+
+        THEN ("it still matches") {
+            CHECK(matcher.match(std::tuple{expected}));
+            CHECK(not matcher.match(std::tuple{std::array<int, 64>{1}}));
+        }
+    }
+
+    GIVEN ("a matcher too large to fit inline and a memory resource") {
+        alignas(std::max_align_t) std::byte buffer[1024];
+        std::pmr::monotonic_buffer_resource arena{
+            buffer,
+            sizeof(buffer),
+            std::pmr::null_memory_resource()
+        };
+        std::array<int, 64> const expected{};
+        Inline_Matcher<std::tuple<std::array<int, 64>>, 16> matcher{
+            std::allocator_arg,
+            &arena,
+            wrap_for<std::tuple<std::array<int, 64>>>(
+                matches(std::tuple{expected})
+            ),
+        };
+
+        THEN ("the matcher is allocated from the resource") {
+            auto const* address =
+                reinterpret_cast<std::byte const*>(&matcher.base());
+            CHECK(address >= buffer);
+            CHECK(address < buffer + sizeof(buffer));
+        }
+
+        WHEN ("it is moved") {
+            Inline_Matcher<std::tuple<std::array<int, 64>>, 16> moved{
+                std::move(matcher)
+            };
+
+            THEN ("the new object still matches") {
+                CHECK(moved.match(std::tuple{expected}));
+                CHECK(not moved.match(std::tuple{std::array<int, 64>{1}}));
+            }
+        }
+    }
+
+    GIVEN ("a matcher already on the heap") {
+        auto owned = std::make_unique<
+            c2mm::matchers::Typed_Wrapper<int, int>
+        >(4);
+        auto const* address = owned.get();
+        Inline_Matcher<int> matcher{std::move(owned)};
+
+        THEN ("it is adopted") {
+            CHECK(&matcher.base() == address);
+            CHECK(matcher.match(4));
+            CHECK(not matcher.match(5));
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef C2MM__MATCHERS__MATCH_COST_HPP_
+#define C2MM__MATCHERS__MATCH_COST_HPP_
+
+#include <type_traits>
+
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/cx/Tuple.hpp"
+#include "c2mm/matchers/utils.hpp"
+
+namespace c2mm::matchers {
+/**
+ * Estimated relative cost of matching a value against a constraint of type @p
+ * T_Constraint. Only the order of costs matters. Composite matchers may use it
+ * to evaluate cheap constraints first.
+ *
+ * By default, comparing scalar values costs 1, comparing other values (e.g.
+ * strings) costs 4 and any other matcher costs 16. Matchers of this library
+ * specialize it to reflect what they compare. Specialize it for other
+ * constraint types to tune their cost.
+ *
+ * @tparam T_Constraint The constraint type, without cv-ref qualifiers.
+ */
+template <typename T_Constraint>
+struct Match_Cost : std::integral_constant<
+    unsigned,
+    utils::is_matcher_v<T_Constraint> ? 16 :
+    std::is_scalar_v<T_Constraint> ? 1 :
+    4
+> {};
+
+template <typename T_Constraint>
+inline constexpr unsigned match_cost_v =
+    Match_Cost<std::remove_cvref_t<T_Constraint>>::value;
+
+/**
+ * Comparing against an expected value costs the same as comparing to it
+ * directly.
+ */
+template <typename T_Expected, typename T_Binary_Pred>
+struct Match_Cost<cx::Comparison<T_Expected, T_Binary_Pred>>
+      : Match_Cost<T_Expected> {};
+
+/**
+ * The cost of a tuple matcher is the cost of all its constraints.
+ */
+template <typename... T_Constraints>
+struct Match_Cost<cx::Tuple<T_Constraints...>>
+      : std::integral_constant<
+            unsigned,
+            (0u + ... + match_cost_v<T_Constraints>)
+        > {};
+}  // namespace c2mm::matchers
+
+#endif  // C2MM__MATCHERS__MATCH_COST_HPP_
@@ -0,0 +1,77 @@
+#ifndef C2MM__MATCHERS__MATCHER_BASE_HPP_
+#define C2MM__MATCHERS__MATCHER_BASE_HPP_
+
+#include <string>
+
+#ifndef C2MM_NO_CATCH2
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_templated.hpp>
+#endif
+
+namespace c2mm::matchers {
+#ifndef C2MM_NO_CATCH2
+/// Base of every runtime matcher.
+using Untyped_Matcher_Base = Catch::Matchers::MatcherUntypedBase;
+
+/// Base of matchers of values of type @p T_Actual.
+template <typename T_Actual>
+using Matcher_Base = Catch::Matchers::MatcherBase<T_Actual>;
+
+/// Base of matchers whose @c match is a template.
+using Generic_Matcher_Base = Catch::Matchers::MatcherGenericBase;
+#else
+/**
+ * Stand-in for Catch2's @c MatcherUntypedBase, used when @c C2MM_NO_CATCH2 is
+ * defined. It has the same interface, so the matchers of this library are
+ * written the same way for both.
+ */
+class Untyped_Matcher_Base {
+  public:
+    Untyped_Matcher_Base () = default;
+    Untyped_Matcher_Base (Untyped_Matcher_Base const&) = default;
+    Untyped_Matcher_Base (Untyped_Matcher_Base&&) = default;
+    Untyped_Matcher_Base& operator = (Untyped_Matcher_Base const&) = delete;
+    Untyped_Matcher_Base& operator = (Untyped_Matcher_Base&&) = delete;
+
+    /**
+     * Provides a human-oriented description of what this matcher does.
+     */
+    std::string toString () const { return describe(); }
+
+  protected:
+    virtual ~Untyped_Matcher_Base () = default;
+    virtual std::string describe () const = 0;
+};
+
+/**
+ * Stand-in for Catch2's @c MatcherBase, used when @c C2MM_NO_CATCH2 is
+ * defined.
+ *
+ * @tparam T_Actual Type of value to match.
+ */
+template <typename T_Actual>
+class Matcher_Base : public Untyped_Matcher_Base {
+  public:
+    /**
+     * Indicates whether @p actual matches.
+     */
+    virtual bool match (T_Actual const& actual) const = 0;
+};
+
+/**
+ * Stand-in for Catch2's @c MatcherGenericBase, used when @c C2MM_NO_CATCH2 is
+ * defined.
+ */
+class Generic_Matcher_Base : public Untyped_Matcher_Base {
+  public:
+    Generic_Matcher_Base () = default;
+    ~Generic_Matcher_Base () override = default;
+    Generic_Matcher_Base (Generic_Matcher_Base const&) = default;
+    Generic_Matcher_Base (Generic_Matcher_Base&&) = default;
+    Generic_Matcher_Base& operator = (Generic_Matcher_Base const&) = delete;
+    Generic_Matcher_Base& operator = (Generic_Matcher_Base&&) = delete;
+};
+#endif
+}  // namespace c2mm::matchers
+
+#endif  // C2MM__MATCHERS__MATCHER_BASE_HPP_
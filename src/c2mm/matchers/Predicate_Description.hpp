@@ -0,0 +1,60 @@
+#ifndef C2MM__MATCHERS__PREDICATE_DESCRIPTION_HPP_
+#define C2MM__MATCHERS__PREDICATE_DESCRIPTION_HPP_
+
+#include <functional>
+#include <string_view>
+
+#include "c2mm/matchers/cx/Comparison.hpp"
+
+namespace c2mm::matchers {
+/**
+ * Static description of a binary predicate, prefixed to the expected value
+ * when a @c Comparison_Matcher is described. Only defined for the standard
+ * comparison function objects. Specialize it to describe other predicates.
+ *
+ * @tparam T_Binary_Pred The type of the predicate.
+ */
+template <typename T_Binary_Pred>
+struct Predicate_Description;
+
+template <>
+struct Predicate_Description<std::equal_to<>> {
+    static constexpr std::string_view value = "== ";
+};
+
+template <>
+struct Predicate_Description<std::not_equal_to<>> {
+    static constexpr std::string_view value = "!= ";
+};
+
+template <>
+struct Predicate_Description<std::greater<>> {
+    static constexpr std::string_view value = "> ";
+};
+
+template <>
+struct Predicate_Description<std::less<>> {
+    static constexpr std::string_view value = "< ";
+};
+
+template <>
+struct Predicate_Description<std::greater_equal<>> {
+    static constexpr std::string_view value = ">= ";
+};
+
+template <>
+struct Predicate_Description<std::less_equal<>> {
+    static constexpr std::string_view value = "<= ";
+};
+
+/**
+ * The tolerance is described after this prefix, followed by " of " and the
+ * expected value, as in "within 2 of 1".
+ */
+template <typename T_Tolerance>
+struct Predicate_Description<cx::Within_Tolerance<T_Tolerance>> {
+    static constexpr std::string_view value = "within ";
+};
+}  // namespace c2mm::matchers
+
+#endif  // C2MM__MATCHERS__PREDICATE_DESCRIPTION_HPP_
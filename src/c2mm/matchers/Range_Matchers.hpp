@@ -0,0 +1,432 @@
+#ifndef C2MM__MATCHERS__RANGE_MATCHERS_HPP_
+#define C2MM__MATCHERS__RANGE_MATCHERS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
+#include "c2mm/matchers/Predicate_Description.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/simd/kernels.hpp"
+#include "c2mm/matchers/utils.hpp"
+
+namespace c2mm::matchers {
+namespace impl_ {
+template <typename T_Binary_Pred>
+struct Simd_Compare;
+
+template <>
+struct Simd_Compare<std::equal_to<>> {
+    static constexpr simd::Compare value = simd::Compare::equal;
+};
+
+template <>
+struct Simd_Compare<std::not_equal_to<>> {
+    static constexpr simd::Compare value = simd::Compare::not_equal;
+};
+
+template <>
+struct Simd_Compare<std::less<>> {
+    static constexpr simd::Compare value = simd::Compare::less;
+};
+
+template <>
+struct Simd_Compare<std::greater<>> {
+    static constexpr simd::Compare value = simd::Compare::greater;
+};
+
+template <>
+struct Simd_Compare<std::less_equal<>> {
+    static constexpr simd::Compare value = simd::Compare::less_equal;
+};
+
+template <>
+struct Simd_Compare<std::greater_equal<>> {
+    static constexpr simd::Compare value = simd::Compare::greater_equal;
+};
+
+template <typename T_Range>
+concept Numeric_Contiguous_Range =
+    std::ranges::contiguous_range<T_Range const> and
+    std::ranges::sized_range<T_Range const> and
+    std::is_arithmetic_v<std::ranges::range_value_t<T_Range>>;
+
+/**
+ * Checks every element of a contiguous array of @p T_Value against a
+ * constraint of type @p T_Constraint with a @c simd kernel. The primary
+ * template handles constraints with no kernel.
+ */
+template <typename T_Value, typename T_Constraint>
+struct Element_Kernel {
+    static constexpr bool exists = false;
+};
+
+template <typename T_Value, typename T_Binary_Pred>
+    requires requires { Simd_Compare<T_Binary_Pred>::value; }
+struct Element_Kernel<T_Value, cx::Comparison<T_Value, T_Binary_Pred>> {
+    static constexpr bool exists = true;
+
+    static bool all_of (
+        T_Value const* data,
+        std::size_t size,
+        cx::Comparison<T_Value, T_Binary_Pred> const& comparison
+    ) {
+        return simd::all_compare<Simd_Compare<T_Binary_Pred>::value>(
+            data,
+            size,
+            comparison.expected()
+        );
+    }
+};
+
+template <typename T_Value>
+    requires std::is_floating_point_v<T_Value>
+struct Element_Kernel<
+    T_Value,
+    cx::Comparison<T_Value, cx::Within_Tolerance<T_Value>>
+> {
+    static constexpr bool exists = true;
+
+    static bool all_of (
+        T_Value const* data,
+        std::size_t size,
+        cx::Comparison<T_Value, cx::Within_Tolerance<T_Value>> const& within
+    ) {
+        return simd::all_within(
+            data,
+            size,
+            within.expected(),
+            within.predicate().tolerance
+        );
+    }
+};
+
+template <typename T_Value, typename T_Expected, typename T_Binary_Pred>
+struct Element_Kernel<T_Value, Comparison_Matcher<T_Expected, T_Binary_Pred>>
+      : Element_Kernel<T_Value, cx::Comparison<T_Expected, T_Binary_Pred>> {
+    static bool all_of (
+        T_Value const* data,
+        std::size_t size,
+        Comparison_Matcher<T_Expected, T_Binary_Pred> const& matcher
+    ) {
+        return Element_Kernel<
+            T_Value,
+            cx::Comparison<T_Expected, T_Binary_Pred>
+        >::all_of(data, size, matcher.comparison());
+    }
+};
+
+/**
+ * Compares two contiguous arrays of @p T_Value element-wise using a predicate
+ * of type @p T_Binary_Pred with a @c simd kernel. The primary template handles
+ * predicates with no kernel.
+ */
+template <typename T_Value, typename T_Binary_Pred>
+struct Elementwise_Kernel {
+    static constexpr bool exists = false;
+};
+
+template <typename T_Value>
+struct Elementwise_Kernel<T_Value, std::equal_to<>> {
+    static constexpr bool exists = true;
+
+    static bool all_of (
+        T_Value const* lhs,
+        T_Value const* rhs,
+        std::size_t size,
+        std::equal_to<> const&
+    ) {
+        return simd::all_equal(lhs, rhs, size);
+    }
+};
+
+template <typename T_Value, typename T_Tolerance>
+    requires (
+        std::is_floating_point_v<T_Value> and
+            std::is_same_v<T_Value, T_Tolerance>
+    ) or (
+        std::is_integral_v<T_Value> and
+            not std::is_same_v<T_Value, bool> and
+            std::is_integral_v<T_Tolerance>
+    )
+struct Elementwise_Kernel<T_Value, cx::Within_Tolerance<T_Tolerance>> {
+    static constexpr bool exists = true;
+
+    static bool all_of (
+        T_Value const* lhs,
+        T_Value const* rhs,
+        std::size_t size,
+        cx::Within_Tolerance<T_Tolerance> const& within
+    ) {
+        if (size == 0) {
+            return true;
+        }
+
+        auto const diff = simd::max_abs_diff(lhs, rhs, size);
+        if constexpr (std::is_integral_v<T_Value>) {
+            return std::cmp_less_equal(diff, within.tolerance);
+        } else {
+            return diff <= within.tolerance;
+        }
+    }
+};
+}  // namespace impl_
+
+/**
+ * Matcher checking that every element of a range satisfies a constraint.
+ *
+ * If the range is contiguous and the constraint is a comparison with one of
+ * the standard comparison predicates, or a floating point @c within, against
+ * a value of exactly the element type, the check runs as a vectorized @c
+ * simd kernel. Any other range or constraint is checked element by element.
+ *
+ * @tparam T_Constraint Type of the constraint, either a matcher or a value
+ *     compared with `operator ==`.
+ */
+template <typename T_Constraint>
+class Each_Element_Matcher final
+      : public Generic_Matcher_Base {
+  public:
+    /**
+     * Construct from the constraint on each element.
+     * @param[in] constraint The constraint every element must satisfy.
+     */
+    template <typename T>
+        requires (
+            not std::is_same_v<std::remove_cvref_t<T>, Each_Element_Matcher>
+        )
+    explicit Each_Element_Matcher (T&& constraint)
+          : constraint_{std::forward<T>(constraint)} {}
+
+    /**
+     * Read-only accessor for the constraint.
+     * @return Constant reference to the @c constraint field.
+     */
+    T_Constraint const& constraint () const { return constraint_; }
+
+    /**
+     * Check every element of @p range against the constraint.
+     * @param[in] range The range to check.
+     * @return @c true if all elements satisfy the constraint, including when
+     *     there are none.
+     */
+    template <std::ranges::input_range T_Range>
+    bool match (T_Range const& range) const {
+        using Value = std::ranges::range_value_t<T_Range>;
+        using Kernel = impl_::Element_Kernel<Value, T_Constraint>;
+
+        if constexpr (
+            impl_::Numeric_Contiguous_Range<T_Range> and Kernel::exists
+        ) {
+            return Kernel::all_of(
+                std::ranges::data(range),
+                std::ranges::size(range),
+                constraint_
+            );
+        } else {
+            return std::ranges::all_of(range, [this] (auto const& value) {
+                return utils::matches(value, constraint_);
+            });
+        }
+    }
+
+    /**
+     * Describe the matcher.
+     * @return The description of the constraint on each element.
+     */
+    std::string describe () const override {
+        return "each element " + utils::describe(constraint_);
+    }
+
+  private:
+    T_Constraint constraint_;
+};
+
+/**
+ * Matcher comparing a range element-wise to an expected range using a binary
+ * predicate. Ranges of different sizes never match.
+ *
+ * If both ranges are contiguous with the same arithmetic element type and the
+ * predicate is @c std::equal_to<> or an @c cx::Within_Tolerance (a bounded
+ * maximum absolute difference), the comparison runs as a vectorized @c simd
+ * kernel. Otherwise, elements are compared one by one.
+ *
+ * @tparam T_Range The type of the expected range. Use a @c std::span to refer
+ *     to an existing array instead of copying it.
+ * @tparam T_Binary_Pred A binary predicate callable with a
+ *     @c Predicate_Description. Called as `predicate(value, expected)` for
+ *     each pair of elements.
+ */
+template <typename T_Range, typename T_Binary_Pred>
+class Elementwise_Matcher final
+      : public Generic_Matcher_Base {
+  public:
+    /**
+     * Construct from required components.
+     * @param[in] expected The range of expected values.
+     * @param[in] predicate A callable to compare a value against the
+     *     corresponding expected value.
+     */
+    template <typename T>
+    explicit Elementwise_Matcher (
+        T&& expected,
+        T_Binary_Pred predicate = T_Binary_Pred{}
+    ) : expected_{std::forward<T>(expected)},
+        predicate_{std::move(predicate)}
+    {}
+
+    /**
+     * Read-only accessor for the expected range.
+     * @return Constant reference to the @c expected field.
+     */
+    T_Range const& expected () const { return expected_; }
+
+    /**
+     * Compare each element of @p range to the corresponding expected element.
+     * @param[in] range The range to compare.
+     * @return @c true if the ranges have the same size and the predicate holds
+     *     for each pair of elements.
+     */
+    template <std::ranges::input_range T_Other>
+    bool match (T_Other const& range) const {
+        using Value = std::ranges::range_value_t<T_Other>;
+        using Kernel = impl_::Elementwise_Kernel<Value, T_Binary_Pred>;
+
+        if constexpr (
+            impl_::Numeric_Contiguous_Range<T_Other> and
+            impl_::Numeric_Contiguous_Range<T_Range> and
+            std::is_same_v<Value, std::ranges::range_value_t<T_Range>> and
+            Kernel::exists
+        ) {
+            auto const size = std::ranges::size(range);
+            return size == std::ranges::size(expected_) and Kernel::all_of(
+                std::ranges::data(range),
+                std::ranges::data(expected_),
+                size,
+                predicate_
+            );
+        } else {
+            return std::ranges::equal(
+                range,
+                expected_,
+                [this] (auto const& value, auto const& expected) -> bool {
+                    return predicate_(value, expected);
+                }
+            );
+        }
+    }
+
+    /**
+     * Describe the matcher.
+     * @return The description of the predicate and the expected range.
+     */
+    std::string describe () const override {
+        return "elements " + utils::describe_comparison(
+            Predicate_Description<T_Binary_Pred>::value,
+            predicate_,
+            expected_
+        );
+    }
+
+  private:
+    T_Range expected_;
+    [[no_unique_address]] T_Binary_Pred predicate_;
+};
+
+/**
+ * Create a matcher to check that every element of a range satisfies @p
+ * constraint.
+ * @param[in] constraint A matcher, typically a comparison such as @c
+ *     less_than, or a value each element must be equal to.
+ * @return A matcher of ranges.
+ */
+template <typename T_Constraint>
+Each_Element_Matcher<std::remove_cvref_t<T_Constraint>>
+each_element (T_Constraint&& constraint) {
+    return Each_Element_Matcher<std::remove_cvref_t<T_Constraint>>{
+        std::forward<T_Constraint>(constraint)
+    };
+}
+
+/**
+ * Create a matcher to check that every element of a range is equal to @p
+ * expected.
+ */
+template <typename T>
+auto all_equal_to (T&& expected) {
+    return each_element(equal_to(std::forward<T>(expected)));
+}
+
+/**
+ * Create a matcher to check that every element of a range is less than @p
+ * expected.
+ */
+template <typename T>
+auto all_less_than (T&& expected) {
+    return each_element(less_than(std::forward<T>(expected)));
+}
+
+/**
+ * Create a matcher to check that every element of a range is greater than @p
+ * expected.
+ */
+template <typename T>
+auto all_greater_than (T&& expected) {
+    return each_element(greater_than(std::forward<T>(expected)));
+}
+
+/**
+ * Create a matcher to check that every element of a range is within @p
+ * tolerance of @p expected.
+ */
+template <typename T, typename T_Tolerance>
+auto all_within (T&& expected, T_Tolerance&& tolerance) {
+    return each_element(within(
+        std::forward<T>(expected),
+        std::forward<T_Tolerance>(tolerance)
+    ));
+}
+
+/**
+ * Create a matcher to check that a range is equal element-wise to @p expected.
+ * @param[in] expected The expected range. Copied unless it is a view.
+ * @return A matcher of ranges.
+ */
+template <typename T_Range>
+Elementwise_Matcher<std::remove_cvref_t<T_Range>, std::equal_to<>>
+range_equal_to (T_Range&& expected) {
+    return Elementwise_Matcher<std::remove_cvref_t<T_Range>, std::equal_to<>>{
+        std::forward<T_Range>(expected)
+    };
+}
+
+/**
+ * Create a matcher to check that the largest absolute difference between the
+ * elements of a range and those of @p expected is at most @p bound.
+ * @param[in] expected The expected range. Copied unless it is a view.
+ * @param[in] bound The largest accepted absolute difference.
+ * @return A matcher of ranges.
+ */
+template <typename T_Range, typename T_Tolerance>
+Elementwise_Matcher<
+    std::remove_cvref_t<T_Range>,
+    cx::Within_Tolerance<std::remove_cvref_t<T_Tolerance>>
+>
+max_abs_diff_within (T_Range&& expected, T_Tolerance&& bound) {
+    return Elementwise_Matcher<
+        std::remove_cvref_t<T_Range>,
+        cx::Within_Tolerance<std::remove_cvref_t<T_Tolerance>>
+    >{
+        std::forward<T_Range>(expected),
+        {std::forward<T_Tolerance>(bound)}
+    };
+}
+}  // namespace c2mm::matchers
+
+#endif  // C2MM__MATCHERS__RANGE_MATCHERS_HPP_
@@ -0,0 +1,117 @@
+#include "c2mm/matchers/Range_Matchers.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+
+#include "c2mm/mock/Mock_Function.hpp"
+
+TEST_CASE ("c2mm::matchers::Each_Element_Matcher") {
+    using namespace c2mm::matchers;
+
+    std::vector<float> const values{0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f, 3.5f,
+        4.0f, 4.5f, 5.0f, 5.5f};
+
+    SECTION ("vectorized comparisons") {
+        CHECK(all_less_than(6.0f).match(values));
+        CHECK(not all_less_than(5.5f).match(values));
+        CHECK(all_greater_than(0.0f).match(values));
+        CHECK(not all_greater_than(0.5f).match(values));
+        CHECK(each_element(less_or_equal_to(5.5f)).match(values));
+        CHECK(not all_equal_to(0.5f).match(values));
+        CHECK(all_equal_to(7).match(std::vector<int>(33, 7)));
+    }
+
+    SECTION ("vectorized tolerance") {
+        CHECK(all_within(3.0f, 2.5f).match(values));
+        CHECK(not all_within(3.0f, 2.25f).match(values));
+    }
+
+    SECTION ("other ranges and element types fall back to a plain loop") {
+        CHECK(all_less_than(6).match(std::list<int>{1, 2, 3}));
+        CHECK(all_less_than(6.0).match(values));
+        CHECK(all_within(3, 2u).match(std::vector<int>{1, 3, 5}));
+        CHECK(not all_within(3, 2u).match(std::vector<int>{1, 3, 6}));
+        CHECK(each_element(2).match(std::array{2, 2}));
+    }
+
+    SECTION ("empty ranges match") {
+        CHECK(all_equal_to(1.0).match(std::vector<double>{}));
+    }
+
+    SECTION (".describe()") {
+        CHECK(all_less_than(3).describe() == "each element < 3");
+        CHECK(each_element(2).describe() == "each element 2");
+        CHECK(all_within(3, 1).describe() == "each element within 1 of 3");
+    }
+}
+
+TEST_CASE ("c2mm::matchers::Elementwise_Matcher") {
+    using namespace c2mm::matchers;
+
+    std::vector<double> const expected{1.0, 2.0, 3.0, 4.0, 5.0};
+
+    SECTION ("range_equal_to") {
+        CHECK(range_equal_to(expected).match(expected));
+        CHECK(not range_equal_to(expected).match(
+            std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.5}
+        ));
+        CHECK(not range_equal_to(expected).match(
+            std::vector<double>{1.0, 2.0, 3.0, 4.0}
+        ));
+        CHECK(range_equal_to(std::vector<int>{1, 2}).match(std::list{1, 2}));
+        CHECK(range_equal_to(std::vector<int>{1, 2}).match(std::array{1, 2}));
+    }
+
+    SECTION ("max_abs_diff_within") {
+        std::vector<double> const actual{1.1, 1.9, 3.0, 4.2, 5.0};
+        CHECK(max_abs_diff_within(expected, 0.25).match(actual));
+        CHECK(not max_abs_diff_within(expected, 0.15).match(actual));
+        CHECK(not max_abs_diff_within(expected, 1.0).match(
+            std::vector<double>{1.0}
+        ));
+
+        std::vector<std::int16_t> const low(40, INT16_MIN);
+        std::vector<std::int16_t> const high(40, INT16_MAX);
+        CHECK(max_abs_diff_within(low, UINT16_MAX).match(high));
+        CHECK(not max_abs_diff_within(low, UINT16_MAX - 1).match(high));
+        CHECK(max_abs_diff_within(std::vector<int>{}, -1).match(
+            std::vector<int>{}
+        ));
+    }
+
+    SECTION ("a span refers to the expected values without copying") {
+        auto const matcher = range_equal_to(std::span{expected});
+        CHECK(matcher.expected().data() == expected.data());
+        CHECK(matcher.match(expected));
+    }
+
+    SECTION (".describe()") {
+        CHECK(range_equal_to(std::vector{1, 2}).describe() ==
+            "elements == { 1, 2 }");
+        CHECK(max_abs_diff_within(std::vector{1, 2}, 3).describe() ==
+            "elements within 3 of { 1, 2 }");
+    }
+}
+
+SCENARIO ("range matchers constrain mocked calls") {
+    GIVEN ("a mock taking a span of samples") {
+        using namespace c2mm::matchers;
+        c2mm::mock::Mock_Function<void(std::span<float const>)> process;
+
+        WHEN ("it is called with samples in range") {
+            std::vector<float> const samples(100, 0.25f);
+            process(std::span{samples});
+
+            THEN ("a range constraint matches the call") {
+                process.check_called(all_within(0.0f, 1.0f));
+            }
+        }
+    }
+}
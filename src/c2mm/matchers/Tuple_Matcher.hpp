@@ -1,17 +1,56 @@
 #ifndef C2MM__MATCHERS__TUPLE_MATCHER_HPP_
 #define C2MM__MATCHERS__TUPLE_MATCHER_HPP_
 
+#include <array>
+#include <cstddef>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
-#include <catch2/matchers/catch_matchers_templated.hpp>
-
+#include "c2mm/matchers/Match_Cost.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
 #include "c2mm/matchers/utils.hpp"
-#include "c2mm/mp/all.hpp"
-#include "c2mm/mp/zip_with.hpp"
 
 namespace c2mm::matchers {
+/**
+ * Order in which a @c Basic_Tuple_Matcher evaluates its constraints.
+ */
+enum class Evaluation_Order {
+    /// Evaluate constraints in the order they are given.
+    declared,
+    /// Evaluate constraints in increasing order of @c Match_Cost. Constraints
+    /// of equal cost are evaluated in the order they are given.
+    cheapest_first,
+};
+
+namespace impl_ {
+template <Evaluation_Order t_order, typename... T_Constraints>
+constexpr auto evaluation_order () {
+    std::array<std::size_t, sizeof...(T_Constraints)> order{};
+    for (std::size_t idx = 0; idx < order.size(); ++idx) {
+        order[idx] = idx;
+    }
+
+    if constexpr (t_order == Evaluation_Order::cheapest_first) {
+        constexpr std::array<unsigned, sizeof...(T_Constraints)> costs{
+            match_cost_v<T_Constraints>...
+        };
+
+        // Stable insertion sort.
+        for (std::size_t idx = 1; idx < order.size(); ++idx) {
+            auto const current = order[idx];
+            auto pos = idx;
+            for (; pos > 0 and costs[order[pos - 1]] > costs[current]; --pos) {
+                order[pos] = order[pos - 1];
+            }
+            order[pos] = current;
+        }
+    }
+
+    return order;
+}
+}  // namespace impl_
+
 /**
  * A composite matcher for @c std::tuple.
  *
@@ -21,16 +60,19 @@ namespace c2mm::matchers {
  * used for the comparison. All comparisons must be true in order for the @c
  * std::tuple to match.
  *
+ * Evaluation stops at the first constraint which is not satisfied.
+ *
+ * @tparam t_order Order in which constraints are evaluated.
  * @tparam T_Constraints Types of the constraints.
  */
-template <typename... T_Constraints>
-class Tuple_Matcher final : Catch::Matchers::MatcherGenericBase {
+template <Evaluation_Order t_order, typename... T_Constraints>
+class Basic_Tuple_Matcher final : Generic_Matcher_Base {
   public:
     /**
      * Construct from a @c std::tuple of @p constraints.
      * @param[in] constraints The constraints to match against.
      */
-    explicit Tuple_Matcher (std::tuple<T_Constraints...> constraints)
+    explicit Basic_Tuple_Matcher (std::tuple<T_Constraints...> constraints)
           : constraints_{std::move(constraints)} {}
 
     /**
@@ -47,10 +89,9 @@ class Tuple_Matcher final : Catch::Matchers::MatcherGenericBase {
      */
     template <typename T_Tuple>
     bool match (T_Tuple const& values) const {
-        using mp::all;
-        using mp::zip_with;
-
-        return all(zip_with(utils::matches, values, constraints_));
+        return [&] <std::size_t... t_idxs> (std::index_sequence<t_idxs...>) {
+            return (matches_at<order_[t_idxs]>(values) and ...);
+        }(std::index_sequence_for<T_Constraints...>{});
     }
 
     /**
@@ -63,19 +104,57 @@ class Tuple_Matcher final : Catch::Matchers::MatcherGenericBase {
     }
 
   private:
+    static constexpr auto order_ =
+        impl_::evaluation_order<t_order, T_Constraints...>();
+
+    template <std::size_t t_idx, typename T_Tuple>
+    bool matches_at (T_Tuple const& values) const {
+        return utils::matches(
+            std::get<t_idx>(values),
+            std::get<t_idx>(constraints_)
+        );
+    }
+
     std::tuple<T_Constraints...> constraints_;
 };
 
 /**
- * Helper function for creating a @c Tuple_Matcher.
- * @param[in] constraints A @c std::tuple of constraints. The constructed @c
- *     Tuple_Matcher will have exactly the same types including reference-ness.
+ * A @c Basic_Tuple_Matcher which evaluates constraints in the order given.
  */
 template <typename... T_Constraints>
-Tuple_Matcher<T_Constraints...> matches (
+using Tuple_Matcher = Basic_Tuple_Matcher<
+    Evaluation_Order::declared,
+    T_Constraints...
+>;
+
+/**
+ * The cost of a tuple matcher is the cost of all its constraints.
+ */
+template <Evaluation_Order t_order, typename... T_Constraints>
+struct Match_Cost<Basic_Tuple_Matcher<t_order, T_Constraints...>>
+      : std::integral_constant<
+            unsigned,
+            (0u + ... + match_cost_v<T_Constraints>)
+        > {};
+
+/**
+ * Helper function for creating a @c Basic_Tuple_Matcher.
+ * @tparam t_order Order in which constraints are evaluated. Defaults to the
+ *     order given.
+ * @param[in] constraints A @c std::tuple of constraints. The constructed @c
+ *     Basic_Tuple_Matcher will have exactly the same types including
+ *     reference-ness.
+ */
+template <
+    Evaluation_Order t_order = Evaluation_Order::declared,
+    typename... T_Constraints
+>
+Basic_Tuple_Matcher<t_order, T_Constraints...> matches (
     std::tuple<T_Constraints...> constraints
 ) {
-    return Tuple_Matcher<T_Constraints...>{std::move(constraints)};
+    return Basic_Tuple_Matcher<t_order, T_Constraints...>{
+        std::move(constraints)
+    };
 }
 }  // namespace c2mm::matchers
 
@@ -1,8 +1,34 @@
 #include "c2mm/matchers/Tuple_Matcher.hpp"
 
+#include <string>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/Match_Cost.hpp"
+
+namespace {
+// Records the order in which constraints are evaluated.
+class Recording_Matcher final : public Catch::Matchers::MatcherGenericBase {
+  public:
+    Recording_Matcher (std::vector<int>& log, int id, bool result)
+          : log_{&log}, id_{id}, result_{result} {}
+
+    template <typename T>
+    bool match (T const&) const {
+        log_->push_back(id_);
+        return result_;
+    }
+
+    std::string describe () const override { return ""; }
+
+  private:
+    std::vector<int>* log_;
+    int id_;
+    bool result_;
+};
+}  // namespace
 
 TEST_CASE ("c2mm::matchers::Tuple_Matcher") {
     using c2mm::matchers::less_than;
@@ -17,5 +43,59 @@ TEST_CASE ("c2mm::matchers::Tuple_Matcher") {
         CHECK(not matcher.match(std::tuple{7, 3.5}));
     }
 
+    SECTION (".match() stops at the first unsatisfied constraint") {
+        std::vector<int> log{};
+        auto const recording = matches(std::tuple{
+            Recording_Matcher{log, 0, true},
+            Recording_Matcher{log, 1, false},
+            Recording_Matcher{log, 2, true},
+        });
+
+        CHECK(not recording.match(std::tuple{0, 0, 0}));
+        CHECK(log == std::vector{0, 1});
+    }
+
     // TODO(emery): test ".describe()"
 }
+
+TEST_CASE ("c2mm::matchers::Tuple_Matcher cost ordering") {
+    using c2mm::matchers::Evaluation_Order;
+    using c2mm::matchers::equal_to;
+    using c2mm::matchers::match_cost_v;
+    using c2mm::matchers::matches;
+
+    SECTION ("costs are estimated from the constraint types") {
+        STATIC_CHECK(match_cost_v<int> < match_cost_v<std::string>);
+        STATIC_CHECK(match_cost_v<decltype(equal_to(1))> == match_cost_v<int>);
+        STATIC_CHECK(
+            match_cost_v<std::string> < match_cost_v<Recording_Matcher>
+        );
+        STATIC_CHECK(
+            match_cost_v<decltype(matches(std::tuple{1, std::string{}}))> ==
+                match_cost_v<int> + match_cost_v<std::string>
+        );
+    }
+
+    SECTION ("cheap constraints are evaluated first") {
+        std::vector<int> log{};
+        auto const recording = matches<Evaluation_Order::cheapest_first>(
+            std::tuple{
+                Recording_Matcher{log, 0, true},
+                std::string{"a"},
+                Recording_Matcher{log, 2, true},
+                3,
+            }
+        );
+
+        CHECK(recording.match(std::tuple{0, std::string{"a"}, 0, 3}));
+        CHECK(log == std::vector{0, 2});
+
+        log.clear();
+        CHECK(not recording.match(std::tuple{0, std::string{"a"}, 0, 4}));
+        CHECK(log.empty());
+
+        log.clear();
+        CHECK(not recording.match(std::tuple{0, std::string{"b"}, 0, 3}));
+        CHECK(log.empty());
+    }
+}
@@ -4,8 +4,8 @@
 #include <string>
 #include <utility>
 
-#include <catch2/matchers/catch_matchers.hpp>
-
+#include "c2mm/matchers/Match_Cost.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
 #include "c2mm/matchers/utils.hpp"
 
 namespace c2mm::matchers {
@@ -21,7 +21,7 @@ namespace c2mm::matchers {
  * @tparam T_Constraint The constraint type to match against.
  */
 template <typename T_Actual, typename T_Constraint>
-class Typed_Wrapper : public Catch::Matchers::MatcherBase<T_Actual> {
+class Typed_Wrapper : public Matcher_Base<T_Actual> {
   public:
     /**
      * Wrap @p constraint in a @c Typed_Wrapper object.
@@ -69,6 +69,13 @@ class Typed_Wrapper : public Catch::Matchers::MatcherBase<T_Actual> {
     T_Constraint constraint_;
 };
 
+/**
+ * Wrapping a constraint doesn't change what it costs to match.
+ */
+template <typename T_Actual, typename T_Constraint>
+struct Match_Cost<Typed_Wrapper<T_Actual, T_Constraint>>
+      : Match_Cost<T_Constraint> {};
+
 /**
  * Helper function to wrap an existing @p constraint.
  *
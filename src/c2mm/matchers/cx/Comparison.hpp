@@ -0,0 +1,204 @@
+#ifndef C2MM__MATCHERS__CX__COMPARISON_HPP_
+#define C2MM__MATCHERS__CX__COMPARISON_HPP_
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace c2mm::matchers::cx {
+/**
+ * Constexpr matcher comparing to an expected value using a binary predicate.
+ *
+ * This is the literal core of @c Comparison_Matcher. It can be evaluated in
+ * constant expressions, e.g. in a @c static_assert, as long as @p T_Expected
+ * and @p T_Binary_Pred allow it. It is also callable, so it can be passed
+ * directly to algorithms as a predicate.
+ *
+ * @tparam T_Expected The type of the expected value.
+ * @tparam T_Binary_Pred A binary predicate callable. Must support the following
+ *     signature: `predicate(value, expected)` where @c value is the variable
+ *     passed to `match(value)`.
+ */
+template <typename T_Expected, typename T_Binary_Pred>
+class Comparison {
+  public:
+    static constexpr bool is_constexpr_matcher = true;
+
+    using Expected = T_Expected;
+    using Predicate = T_Binary_Pred;
+
+    /**
+     * Construct from required components.
+     * @param[in] expected The value expected by the matcher.
+     * @param[in] predicate A callable to compare a value against @p expected.
+     */
+    template <typename T>
+        requires (not std::is_same_v<std::remove_cvref_t<T>, Comparison>)
+    constexpr explicit Comparison (
+        T&& expected,
+        T_Binary_Pred predicate = T_Binary_Pred{}
+    ) : expected_{std::forward<T>(expected)},
+        predicate_{std::move(predicate)}
+    {}
+
+    /**
+     * Read-only accessor for the expected value.
+     * @return Constant reference to the @c expected field.
+     */
+    constexpr T_Expected const& expected () const { return expected_; }
+
+    /**
+     * Read-only accessor for the predicate.
+     * @return Constant reference to the @c predicate field.
+     */
+    constexpr T_Binary_Pred const& predicate () const { return predicate_; }
+
+    /**
+     * Execute the predicate to compare @p value against the stored @c expected.
+     * @param[in] value The value to compare.
+     * @return The result of the predicate.
+     */
+    template <typename T>
+    constexpr bool match (T const& value) const {
+        return predicate_(value, expected_);
+    }
+
+    /**
+     * Equivalent to @c match.
+     */
+    template <typename T>
+    constexpr bool operator () (T const& value) const {
+        return match(value);
+    }
+
+  private:
+    T_Expected expected_;
+    [[no_unique_address]] T_Binary_Pred predicate_;
+};
+
+/**
+ * Binary predicate checking that the absolute difference between a value and
+ * the expected value is at most @c tolerance. Integers are compared without
+ * overflow, whatever their signedness.
+ *
+ * @tparam T_Tolerance The type of the tolerance.
+ */
+template <typename T_Tolerance>
+struct Within_Tolerance {
+    T_Tolerance tolerance;
+
+    template <typename T_Value, typename T_Expected>
+    constexpr bool operator () (
+        T_Value const& value,
+        T_Expected const& expected
+    ) const {
+        if constexpr (
+            std::is_integral_v<T_Value> and
+            std::is_integral_v<T_Expected> and
+            std::is_integral_v<T_Tolerance>
+        ) {
+            using U = std::make_unsigned_t<
+                std::common_type_t<T_Value, T_Expected>
+            >;
+            U const diff = std::cmp_greater(value, expected)
+                ? U(U(value) - U(expected))
+                : U(U(expected) - U(value));
+            return std::cmp_less_equal(diff, tolerance);
+        } else {
+            return (
+                value > expected ? value - expected : expected - value
+            ) <= tolerance;
+        }
+    }
+};
+
+/**
+ * Create a constexpr matcher to check for exact equality with @p expected.
+ */
+template <typename T>
+constexpr Comparison<std::remove_cvref_t<T>, std::equal_to<>>
+equal_to (T&& expected) {
+    return Comparison<std::remove_cvref_t<T>, std::equal_to<>>{
+        std::forward<T>(expected)
+    };
+}
+
+/**
+ * Create a constexpr matcher to check for exact inequality with @p expected.
+ */
+template <typename T>
+constexpr Comparison<std::remove_cvref_t<T>, std::not_equal_to<>>
+not_equal_to (T&& expected) {
+    return Comparison<std::remove_cvref_t<T>, std::not_equal_to<>>{
+        std::forward<T>(expected)
+    };
+}
+
+/**
+ * Create a constexpr matcher to check that values are greater than @p
+ * expected.
+ */
+template <typename T>
+constexpr Comparison<std::remove_cvref_t<T>, std::greater<>>
+greater_than (T&& expected) {
+    return Comparison<std::remove_cvref_t<T>, std::greater<>>{
+        std::forward<T>(expected)
+    };
+}
+
+/**
+ * Create a constexpr matcher to check that values are less than @p expected.
+ */
+template <typename T>
+constexpr Comparison<std::remove_cvref_t<T>, std::less<>>
+less_than (T&& expected) {
+    return Comparison<std::remove_cvref_t<T>, std::less<>>{
+        std::forward<T>(expected)
+    };
+}
+
+/**
+ * Create a constexpr matcher to check that values are greater than or equal
+ * to @p expected.
+ */
+template <typename T>
+constexpr Comparison<std::remove_cvref_t<T>, std::greater_equal<>>
+greater_or_equal_to (T&& expected) {
+    return Comparison<std::remove_cvref_t<T>, std::greater_equal<>>{
+        std::forward<T>(expected)
+    };
+}
+
+/**
+ * Create a constexpr matcher to check that values are less than or equal to
+ * @p expected.
+ */
+template <typename T>
+constexpr Comparison<std::remove_cvref_t<T>, std::less_equal<>>
+less_or_equal_to (T&& expected) {
+    return Comparison<std::remove_cvref_t<T>, std::less_equal<>>{
+        std::forward<T>(expected)
+    };
+}
+
+/**
+ * Create a constexpr matcher to check that values are within @p tolerance of
+ * @p expected.
+ */
+template <typename T, typename T_Tolerance>
+constexpr Comparison<
+    std::remove_cvref_t<T>,
+    Within_Tolerance<std::remove_cvref_t<T_Tolerance>>
+>
+within (T&& expected, T_Tolerance&& tolerance) {
+    return Comparison<
+        std::remove_cvref_t<T>,
+        Within_Tolerance<std::remove_cvref_t<T_Tolerance>>
+    >{
+        std::forward<T>(expected),
+        {std::forward<T_Tolerance>(tolerance)}
+    };
+}
+}  // namespace c2mm::matchers::cx
+
+#endif  // C2MM__MATCHERS__CX__COMPARISON_HPP_
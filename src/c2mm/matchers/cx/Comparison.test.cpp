@@ -0,0 +1,51 @@
+#include "c2mm/matchers/cx/Comparison.hpp"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE ("class c2mm::matchers::cx::Comparison") {
+    using namespace c2mm::matchers::cx;
+
+    SECTION ("matches in constant expressions") {
+        STATIC_CHECK(equal_to(7).match(7));
+        STATIC_CHECK(not equal_to(7).match(7.5));
+        STATIC_CHECK(not_equal_to(7).match(8));
+        STATIC_CHECK(greater_than(7).match(8));
+        STATIC_CHECK(not greater_than(7).match(7));
+        STATIC_CHECK(less_than(7).match(6.9));
+        STATIC_CHECK(greater_or_equal_to(7).match(7));
+        STATIC_CHECK(less_or_equal_to(7).match(7));
+        STATIC_CHECK(not less_or_equal_to(7).match(7.1));
+    }
+
+    SECTION ("is a literal type with no overhead beyond the expected value") {
+        STATIC_CHECK(sizeof(less_than(1)) == sizeof(int));
+        constexpr auto matcher = greater_than(2);
+        STATIC_CHECK(matcher.expected() == 2);
+    }
+
+    SECTION ("can check invariants of tables at compile time") {
+        constexpr std::array table{1, 2, 4, 8, 16, 32};
+        STATIC_CHECK(std::ranges::all_of(table, less_than(64)));
+        STATIC_CHECK(std::ranges::none_of(table, equal_to(3)));
+    }
+
+    SECTION ("checks tolerances without integer overflow") {
+        STATIC_CHECK(within(1.0, 0.25).match(1.25));
+        STATIC_CHECK(not within(1.0, 0.25).match(0.7));
+        STATIC_CHECK(within(-3, 2u).match(-1));
+        STATIC_CHECK(not within(-3, 2u).match(0));
+        STATIC_CHECK(within(INT_MIN, UINT_MAX).match(INT_MAX));
+        STATIC_CHECK(not within(INT_MIN, UINT_MAX - 1).match(INT_MAX));
+        STATIC_CHECK(not within(0, -1).match(0));
+    }
+
+    SECTION ("matches at run time too") {
+        int const value = 5;
+        CHECK(less_than(6)(value));
+        CHECK(not greater_than(6)(value));
+    }
+}
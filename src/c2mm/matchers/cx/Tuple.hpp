@@ -0,0 +1,85 @@
+#ifndef C2MM__MATCHERS__CX__TUPLE_HPP_
+#define C2MM__MATCHERS__CX__TUPLE_HPP_
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/cx/utils.hpp"
+
+namespace c2mm::matchers::cx {
+/**
+ * Constexpr composite matcher for @c std::tuple and other tuple-like types.
+ *
+ * Each constraint is either a constexpr matcher or a value compared with
+ * `operator ==`, matched element-wise against the given tuple of values.
+ * Evaluation is in order and stops at the first unsatisfied constraint.
+ *
+ * @tparam T_Constraints Types of the constraints.
+ */
+template <typename... T_Constraints>
+class Tuple {
+  public:
+    static constexpr bool is_constexpr_matcher = true;
+
+    /**
+     * Construct from a @c std::tuple of @p constraints.
+     * @param[in] constraints The constraints to match against.
+     */
+    constexpr explicit Tuple (std::tuple<T_Constraints...> constraints)
+          : constraints_{std::move(constraints)} {}
+
+    /**
+     * Read-only accessor for the constraints.
+     * @return Constant reference to the @c constraints field.
+     */
+    constexpr std::tuple<T_Constraints...> const& constraints () const {
+        return constraints_;
+    }
+
+    /**
+     * Compares elements of @p values to corresponding constraints.
+     * @param[in] values The values to check for a match.
+     * @return @c true if all constraints match their corresponding values.
+     */
+    template <typename T_Tuple>
+    constexpr bool match (T_Tuple const& values) const {
+        return [&] <std::size_t... t_idxs> (std::index_sequence<t_idxs...>) {
+            return (utils::matches(
+                std::get<t_idxs>(values),
+                std::get<t_idxs>(constraints_)
+            ) and ...);
+        }(std::index_sequence_for<T_Constraints...>{});
+    }
+
+    /**
+     * Equivalent to @c match.
+     */
+    template <typename T_Tuple>
+    constexpr bool operator () (T_Tuple const& values) const {
+        return match(values);
+    }
+
+  private:
+    std::tuple<T_Constraints...> constraints_;
+};
+
+/**
+ * Helper function for creating a @c Tuple.
+ * @param[in] constraints The constraints, one per tuple element.
+ * @return A constexpr matcher of tuples.
+ */
+template <typename... T_Constraints>
+constexpr Tuple<std::remove_cvref_t<T_Constraints>...> tuple (
+    T_Constraints&&... constraints
+) {
+    return Tuple<std::remove_cvref_t<T_Constraints>...>{
+        std::tuple<std::remove_cvref_t<T_Constraints>...>{
+            std::forward<T_Constraints>(constraints)...
+        }
+    };
+}
+}  // namespace c2mm::matchers::cx
+
+#endif  // C2MM__MATCHERS__CX__TUPLE_HPP_
@@ -0,0 +1,47 @@
+#include "c2mm/matchers/cx/Tuple.hpp"
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/cx/Comparison.hpp"
+
+TEST_CASE ("class c2mm::matchers::cx::Tuple") {
+    using namespace c2mm::matchers::cx;
+
+    constexpr auto matcher = tuple(7, less_than(3.14159));
+
+    SECTION ("matches in constant expressions") {
+        STATIC_CHECK(matcher.match(std::tuple{7, 3}));
+        STATIC_CHECK(matcher.match(std::pair{7.0, 3}));
+        STATIC_CHECK(not matcher.match(std::tuple{7.2, 3.1}));
+        STATIC_CHECK(not matcher.match(std::tuple{7, 3.5}));
+    }
+
+    SECTION ("nests") {
+        constexpr auto nested = tuple(tuple(1, 2), greater_than(0));
+        STATIC_CHECK(nested.match(std::tuple{std::tuple{1, 2}, 1}));
+        STATIC_CHECK(not nested.match(std::tuple{std::tuple{1, 3}, 1}));
+    }
+
+    SECTION ("can check invariants of tables at compile time") {
+        struct Entry {
+            int key;
+            int value;
+        };
+        constexpr std::array<Entry, 3> table{{{1, 10}, {2, 20}, {3, 30}}};
+        constexpr bool values_are_scaled_keys = [&] {
+            for (auto const& entry : table) {
+                if (not tuple(less_than(4), entry.key * 10).match(
+                    std::tuple{entry.key, entry.value}
+                )) {
+                    return false;
+                }
+            }
+            return true;
+        }();
+        STATIC_CHECK(values_are_scaled_keys);
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef C2MM__MATCHERS__CX__UTILS_HPP_
+#define C2MM__MATCHERS__CX__UTILS_HPP_
+
+#include <type_traits>
+
+namespace c2mm::matchers::cx::utils {
+/**
+ * Type trait identifying whether or not @p T is a constexpr matcher.
+ *
+ * Constexpr matchers are literal types which declare a static data member @c
+ * is_constexpr_matcher equal to @c true and provide a constexpr `match(value)`.
+ * They don't depend on Catch2.
+ */
+template <typename T>
+struct is_matcher : std::bool_constant<
+    requires { requires std::remove_cvref_t<T>::is_constexpr_matcher; }
+> {};
+
+template <typename T>
+inline constexpr bool is_matcher_v = is_matcher<T>::value;
+
+/**
+ * Ensure that @p value matches @p constraint, in a constant expression if
+ * the comparison allows it.
+ *
+ * If @p constraint is a constexpr matcher, then this is is equivalent to:
+ * @code
+ *     constraint.match(value)
+ * @endcode
+ * Otherwise, this is equivalent to:
+ * @code
+ *     value == constraint
+ * @endcode
+ *
+ * @param[in] value The value to check against the constraint.
+ * @param[in] constraint @p value should conform to this as described above.
+ *
+ * @return @c true if @p value conforms to the @p constraint.
+ */
+inline constexpr auto matches = [] (
+    auto const& value,
+    auto const& constraint
+) -> bool {
+    if constexpr (is_matcher_v<decltype(constraint)>) {
+        return constraint.match(value);
+    } else {
+        return value == constraint;
+    }
+};
+}  // namespace c2mm::matchers::cx::utils
+
+#endif  // C2MM__MATCHERS__CX__UTILS_HPP_
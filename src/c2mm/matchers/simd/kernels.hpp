@@ -0,0 +1,560 @@
+#ifndef C2MM__MATCHERS__SIMD__KERNELS_HPP_
+#define C2MM__MATCHERS__SIMD__KERNELS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace c2mm::matchers::simd {
+/**
+ * Comparisons supported by @c all_compare.
+ */
+enum class Compare {
+    equal,
+    not_equal,
+    less,
+    greater,
+    less_equal,
+    greater_equal,
+};
+
+/**
+ * Type of the absolute difference of two values of type @p T. Unsigned for
+ * integers so that it never overflows.
+ */
+template <typename T>
+using Abs_Diff = typename std::conditional_t<
+    std::is_integral_v<T>,
+    std::make_unsigned<T>,
+    std::type_identity<T>
+>::type;
+
+namespace impl_ {
+template <Compare t_cmp, typename T>
+constexpr bool compare (T lhs, T rhs) {
+    switch (t_cmp) {
+        case Compare::equal: return lhs == rhs;
+        case Compare::not_equal: return lhs != rhs;
+        case Compare::less: return lhs < rhs;
+        case Compare::greater: return lhs > rhs;
+        case Compare::less_equal: return lhs <= rhs;
+        case Compare::greater_equal: return lhs >= rhs;
+    }
+    return false;
+}
+
+template <typename T>
+constexpr Abs_Diff<T> abs_diff (T lhs, T rhs) {
+    if constexpr (std::is_integral_v<T>) {
+        using U = Abs_Diff<T>;
+        return lhs > rhs ? U(U(lhs) - U(rhs)) : U(U(rhs) - U(lhs));
+    } else {
+        return lhs > rhs ? lhs - rhs : rhs - lhs;
+    }
+}
+
+/**
+ * Vector operations on @p T for the widest instruction set enabled at compile
+ * time. The primary template is intentionally not defined: types without a
+ * specialization only use the scalar kernels.
+ *
+ * Every specialization provides @c Reg, @c width, @c load, @c splat, @c cmp,
+ * @c all_true and @c and_. Floating point specializations also provide @c
+ * or_, @c abs_diff, @c max, @c unordered, @c any_true and @c reduce_max.
+ */
+template <typename T>
+struct Vec;
+
+#if defined(__AVX2__)
+template <>
+struct Vec<float> {
+    using Reg = __m256;
+    static constexpr std::size_t width = 8;
+
+    static Reg load (float const* p) { return _mm256_loadu_ps(p); }
+    static Reg splat (float v) { return _mm256_set1_ps(v); }
+
+    template <Compare t_cmp>
+    static Reg cmp (Reg a, Reg b) {
+        switch (t_cmp) {
+            case Compare::equal: return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+            case Compare::not_equal: return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+            case Compare::less: return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+            case Compare::greater: return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+            case Compare::less_equal: return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+            case Compare::greater_equal:
+                return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+        }
+        return a;
+    }
+
+    static Reg and_ (Reg a, Reg b) { return _mm256_and_ps(a, b); }
+    static Reg or_ (Reg a, Reg b) { return _mm256_or_ps(a, b); }
+    static bool all_true (Reg m) { return _mm256_movemask_ps(m) == 0xFF; }
+    static bool any_true (Reg m) { return _mm256_movemask_ps(m) != 0; }
+
+    static Reg abs_diff (Reg a, Reg b) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_sub_ps(a, b));
+    }
+
+    static Reg max (Reg a, Reg b) { return _mm256_max_ps(a, b); }
+    static Reg unordered (Reg a) { return _mm256_cmp_ps(a, a, _CMP_UNORD_Q); }
+
+    static float reduce_max (Reg a) {
+        alignas(32) float lanes[width];
+        _mm256_store_ps(lanes, a);
+        return *std::max_element(lanes, lanes + width);
+    }
+};
+
+template <>
+struct Vec<double> {
+    using Reg = __m256d;
+    static constexpr std::size_t width = 4;
+
+    static Reg load (double const* p) { return _mm256_loadu_pd(p); }
+    static Reg splat (double v) { return _mm256_set1_pd(v); }
+
+    template <Compare t_cmp>
+    static Reg cmp (Reg a, Reg b) {
+        switch (t_cmp) {
+            case Compare::equal: return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+            case Compare::not_equal: return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ);
+            case Compare::less: return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+            case Compare::greater: return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+            case Compare::less_equal: return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+            case Compare::greater_equal:
+                return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+        }
+        return a;
+    }
+
+    static Reg and_ (Reg a, Reg b) { return _mm256_and_pd(a, b); }
+    static Reg or_ (Reg a, Reg b) { return _mm256_or_pd(a, b); }
+    static bool all_true (Reg m) { return _mm256_movemask_pd(m) == 0xF; }
+    static bool any_true (Reg m) { return _mm256_movemask_pd(m) != 0; }
+
+    static Reg abs_diff (Reg a, Reg b) {
+        return _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(a, b));
+    }
+
+    static Reg max (Reg a, Reg b) { return _mm256_max_pd(a, b); }
+    static Reg unordered (Reg a) { return _mm256_cmp_pd(a, a, _CMP_UNORD_Q); }
+
+    static double reduce_max (Reg a) {
+        alignas(32) double lanes[width];
+        _mm256_store_pd(lanes, a);
+        return *std::max_element(lanes, lanes + width);
+    }
+};
+
+template <typename T, std::size_t t_width, typename T_Ops>
+struct Int_Vec_256 {
+    using Reg = __m256i;
+    static constexpr std::size_t width = t_width;
+
+    static Reg load (T const* p) {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    }
+
+    static Reg splat (T v) { return T_Ops::splat(v); }
+
+    template <Compare t_cmp>
+    static Reg cmp (Reg a, Reg b) {
+        Reg const ones = _mm256_set1_epi32(-1);
+        switch (t_cmp) {
+            case Compare::equal: return T_Ops::eq(a, b);
+            case Compare::not_equal:
+                return _mm256_xor_si256(T_Ops::eq(a, b), ones);
+            case Compare::less: return T_Ops::gt(b, a);
+            case Compare::greater: return T_Ops::gt(a, b);
+            case Compare::less_equal:
+                return _mm256_xor_si256(T_Ops::gt(a, b), ones);
+            case Compare::greater_equal:
+                return _mm256_xor_si256(T_Ops::gt(b, a), ones);
+        }
+        return a;
+    }
+
+    static Reg and_ (Reg a, Reg b) { return _mm256_and_si256(a, b); }
+    static bool all_true (Reg m) { return _mm256_movemask_epi8(m) == -1; }
+};
+
+struct Epi16_256 {
+    static __m256i splat (std::int16_t v) { return _mm256_set1_epi16(v); }
+    static __m256i eq (__m256i a, __m256i b) {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+    static __m256i gt (__m256i a, __m256i b) {
+        return _mm256_cmpgt_epi16(a, b);
+    }
+};
+
+struct Epi32_256 {
+    static __m256i splat (std::int32_t v) { return _mm256_set1_epi32(v); }
+    static __m256i eq (__m256i a, __m256i b) {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+    static __m256i gt (__m256i a, __m256i b) {
+        return _mm256_cmpgt_epi32(a, b);
+    }
+};
+
+template <>
+struct Vec<std::int16_t> : Int_Vec_256<std::int16_t, 16, Epi16_256> {};
+
+template <>
+struct Vec<std::int32_t> : Int_Vec_256<std::int32_t, 8, Epi32_256> {};
+
+#elif defined(__SSE2__)
+template <>
+struct Vec<float> {
+    using Reg = __m128;
+    static constexpr std::size_t width = 4;
+
+    static Reg load (float const* p) { return _mm_loadu_ps(p); }
+    static Reg splat (float v) { return _mm_set1_ps(v); }
+
+    template <Compare t_cmp>
+    static Reg cmp (Reg a, Reg b) {
+        switch (t_cmp) {
+            case Compare::equal: return _mm_cmpeq_ps(a, b);
+            case Compare::not_equal: return _mm_cmpneq_ps(a, b);
+            case Compare::less: return _mm_cmplt_ps(a, b);
+            case Compare::greater: return _mm_cmpgt_ps(a, b);
+            case Compare::less_equal: return _mm_cmple_ps(a, b);
+            case Compare::greater_equal: return _mm_cmpge_ps(a, b);
+        }
+        return a;
+    }
+
+    static Reg and_ (Reg a, Reg b) { return _mm_and_ps(a, b); }
+    static Reg or_ (Reg a, Reg b) { return _mm_or_ps(a, b); }
+    static bool all_true (Reg m) { return _mm_movemask_ps(m) == 0xF; }
+    static bool any_true (Reg m) { return _mm_movemask_ps(m) != 0; }
+
+    static Reg abs_diff (Reg a, Reg b) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(a, b));
+    }
+
+    static Reg max (Reg a, Reg b) { return _mm_max_ps(a, b); }
+    static Reg unordered (Reg a) { return _mm_cmpunord_ps(a, a); }
+
+    static float reduce_max (Reg a) {
+        alignas(16) float lanes[width];
+        _mm_store_ps(lanes, a);
+        return *std::max_element(lanes, lanes + width);
+    }
+};
+
+template <>
+struct Vec<double> {
+    using Reg = __m128d;
+    static constexpr std::size_t width = 2;
+
+    static Reg load (double const* p) { return _mm_loadu_pd(p); }
+    static Reg splat (double v) { return _mm_set1_pd(v); }
+
+    template <Compare t_cmp>
+    static Reg cmp (Reg a, Reg b) {
+        switch (t_cmp) {
+            case Compare::equal: return _mm_cmpeq_pd(a, b);
+            case Compare::not_equal: return _mm_cmpneq_pd(a, b);
+            case Compare::less: return _mm_cmplt_pd(a, b);
+            case Compare::greater: return _mm_cmpgt_pd(a, b);
+            case Compare::less_equal: return _mm_cmple_pd(a, b);
+            case Compare::greater_equal: return _mm_cmpge_pd(a, b);
+        }
+        return a;
+    }
+
+    static Reg and_ (Reg a, Reg b) { return _mm_and_pd(a, b); }
+    static Reg or_ (Reg a, Reg b) { return _mm_or_pd(a, b); }
+    static bool all_true (Reg m) { return _mm_movemask_pd(m) == 0x3; }
+    static bool any_true (Reg m) { return _mm_movemask_pd(m) != 0; }
+
+    static Reg abs_diff (Reg a, Reg b) {
+        return _mm_andnot_pd(_mm_set1_pd(-0.0), _mm_sub_pd(a, b));
+    }
+
+    static Reg max (Reg a, Reg b) { return _mm_max_pd(a, b); }
+    static Reg unordered (Reg a) { return _mm_cmpunord_pd(a, a); }
+
+    static double reduce_max (Reg a) {
+        alignas(16) double lanes[width];
+        _mm_store_pd(lanes, a);
+        return std::max(lanes[0], lanes[1]);
+    }
+};
+
+template <typename T, std::size_t t_width, typename T_Ops>
+struct Int_Vec_128 {
+    using Reg = __m128i;
+    static constexpr std::size_t width = t_width;
+
+    static Reg load (T const* p) {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+    }
+
+    static Reg splat (T v) { return T_Ops::splat(v); }
+
+    template <Compare t_cmp>
+    static Reg cmp (Reg a, Reg b) {
+        Reg const ones = _mm_set1_epi32(-1);
+        switch (t_cmp) {
+            case Compare::equal: return T_Ops::eq(a, b);
+            case Compare::not_equal:
+                return _mm_xor_si128(T_Ops::eq(a, b), ones);
+            case Compare::less: return T_Ops::gt(b, a);
+            case Compare::greater: return T_Ops::gt(a, b);
+            case Compare::less_equal:
+                return _mm_xor_si128(T_Ops::gt(a, b), ones);
+            case Compare::greater_equal:
+                return _mm_xor_si128(T_Ops::gt(b, a), ones);
+        }
+        return a;
+    }
+
+    static Reg and_ (Reg a, Reg b) { return _mm_and_si128(a, b); }
+    static bool all_true (Reg m) { return _mm_movemask_epi8(m) == 0xFFFF; }
+};
+
+struct Epi16_128 {
+    static __m128i splat (std::int16_t v) { return _mm_set1_epi16(v); }
+    static __m128i eq (__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    static __m128i gt (__m128i a, __m128i b) { return _mm_cmpgt_epi16(a, b); }
+};
+
+struct Epi32_128 {
+    static __m128i splat (std::int32_t v) { return _mm_set1_epi32(v); }
+    static __m128i eq (__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    static __m128i gt (__m128i a, __m128i b) { return _mm_cmpgt_epi32(a, b); }
+};
+
+template <>
+struct Vec<std::int16_t> : Int_Vec_128<std::int16_t, 8, Epi16_128> {};
+
+template <>
+struct Vec<std::int32_t> : Int_Vec_128<std::int32_t, 4, Epi32_128> {};
+#endif
+
+template <typename T>
+concept Has_Vec = requires { Vec<T>::width; };
+
+template <typename T>
+concept Has_Float_Vec = Has_Vec<T> and std::is_floating_point_v<T>;
+
+// Number of vectors processed per iteration of the main loops.
+inline constexpr std::size_t unroll = 4;
+}  // namespace impl_
+
+/**
+ * Whether `data[i] <op> value` holds for every element.
+ *
+ * @param[in] data Pointer to the first element.
+ * @param[in] size Number of elements.
+ * @param[in] value Value each element is compared to.
+ *
+ * @return @c true if the comparison holds for all elements, including when
+ *     there are none.
+ */
+template <Compare t_cmp, typename T>
+bool all_compare (T const* data, std::size_t size, T value) {
+    std::size_t idx = 0;
+
+    if constexpr (impl_::Has_Vec<T>) {
+        using V = impl_::Vec<T>;
+        constexpr std::size_t step = V::width * impl_::unroll;
+
+        auto const rhs = V::splat(value);
+        for (; idx + step <= size; idx += step) {
+            auto m = V::template cmp<t_cmp>(V::load(data + idx), rhs);
+            for (std::size_t k = 1; k < impl_::unroll; ++k) {
+                m = V::and_(m, V::template cmp<t_cmp>(
+                    V::load(data + idx + k * V::width),
+                    rhs
+                ));
+            }
+            if (not V::all_true(m)) {
+                return false;
+            }
+        }
+        for (; idx + V::width <= size; idx += V::width) {
+            if (not V::all_true(
+                V::template cmp<t_cmp>(V::load(data + idx), rhs)
+            )) {
+                return false;
+            }
+        }
+    }
+
+    bool result = true;
+    for (; idx < size; ++idx) {
+        result &= impl_::compare<t_cmp>(data[idx], value);
+    }
+    return result;
+}
+
+/**
+ * Whether `|data[i] - value| <= tolerance` holds for every element.
+ *
+ * @param[in] data Pointer to the first element.
+ * @param[in] size Number of elements.
+ * @param[in] value Value each element is compared to.
+ * @param[in] tolerance Largest accepted absolute difference.
+ *
+ * @return @c true if every element is within @p tolerance of @p value,
+ *     including when there are none. NaN is never within tolerance.
+ */
+template <typename T>
+bool all_within (
+    T const* data,
+    std::size_t size,
+    T value,
+    Abs_Diff<T> tolerance
+) {
+    std::size_t idx = 0;
+
+    if constexpr (impl_::Has_Float_Vec<T>) {
+        using V = impl_::Vec<T>;
+        constexpr std::size_t step = V::width * impl_::unroll;
+
+        auto const rhs = V::splat(value);
+        auto const tol = V::splat(tolerance);
+        auto const within = [&] (std::size_t off) {
+            return V::template cmp<Compare::less_equal>(
+                V::abs_diff(V::load(data + off), rhs),
+                tol
+            );
+        };
+        for (; idx + step <= size; idx += step) {
+            auto m = within(idx);
+            for (std::size_t k = 1; k < impl_::unroll; ++k) {
+                m = V::and_(m, within(idx + k * V::width));
+            }
+            if (not V::all_true(m)) {
+                return false;
+            }
+        }
+    }
+
+    bool result = true;
+    for (; idx < size; ++idx) {
+        result &= impl_::abs_diff(data[idx], value) <= tolerance;
+    }
+    return result;
+}
+
+/**
+ * Whether `lhs[i] == rhs[i]` holds for every element.
+ *
+ * @param[in] lhs Pointer to the first element of one range.
+ * @param[in] rhs Pointer to the first element of the other range.
+ * @param[in] size Number of elements in each range.
+ *
+ * @return @c true if the ranges are equal element-wise.
+ */
+template <typename T>
+bool all_equal (
+    T const* lhs,
+    std::type_identity_t<T> const* rhs,
+    std::size_t size
+) {
+    if constexpr (
+        std::is_integral_v<T> and
+        std::has_unique_object_representations_v<T>
+    ) {
+        // Equal integers have equal bytes, and `memcmp` is vectorized already.
+        return size == 0 or std::memcmp(lhs, rhs, size * sizeof(T)) == 0;
+    } else {
+        std::size_t idx = 0;
+
+        if constexpr (impl_::Has_Vec<T>) {
+            using V = impl_::Vec<T>;
+            constexpr std::size_t step = V::width * impl_::unroll;
+
+            for (; idx + step <= size; idx += step) {
+                auto m = V::template cmp<Compare::equal>(
+                    V::load(lhs + idx),
+                    V::load(rhs + idx)
+                );
+                for (std::size_t k = 1; k < impl_::unroll; ++k) {
+                    auto const off = idx + k * V::width;
+                    m = V::and_(m, V::template cmp<Compare::equal>(
+                        V::load(lhs + off),
+                        V::load(rhs + off)
+                    ));
+                }
+                if (not V::all_true(m)) {
+                    return false;
+                }
+            }
+        }
+
+        bool result = true;
+        for (; idx < size; ++idx) {
+            result &= lhs[idx] == rhs[idx];
+        }
+        return result;
+    }
+}
+
+/**
+ * The largest absolute difference `|lhs[i] - rhs[i]|`.
+ *
+ * For floating point, the result is NaN if any difference is NaN.
+ *
+ * @param[in] lhs Pointer to the first element of one range.
+ * @param[in] rhs Pointer to the first element of the other range.
+ * @param[in] size Number of elements in each range.
+ *
+ * @return The largest absolute difference, or zero if there are no elements.
+ */
+template <typename T>
+Abs_Diff<T> max_abs_diff (
+    T const* lhs,
+    std::type_identity_t<T> const* rhs,
+    std::size_t size
+) {
+    std::size_t idx = 0;
+    Abs_Diff<T> result{0};
+
+    if constexpr (impl_::Has_Float_Vec<T>) {
+        using V = impl_::Vec<T>;
+
+        auto acc = V::splat(T{0});
+        auto nan = V::unordered(acc);
+        for (; idx + V::width <= size; idx += V::width) {
+            auto const diff =
+                V::abs_diff(V::load(lhs + idx), V::load(rhs + idx));
+            acc = V::max(acc, diff);
+            nan = V::or_(nan, V::unordered(diff));
+        }
+        if (V::any_true(nan)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        result = V::reduce_max(acc);
+    }
+
+    for (; idx < size; ++idx) {
+        auto const diff = impl_::abs_diff(lhs[idx], rhs[idx]);
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(diff)) {
+                return diff;
+            }
+        }
+        result = std::max(result, diff);
+    }
+    return result;
+}
+}  // namespace c2mm::matchers::simd
+
+#endif  // C2MM__MATCHERS__SIMD__KERNELS_HPP_
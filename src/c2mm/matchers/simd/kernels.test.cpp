@@ -0,0 +1,183 @@
+#include "c2mm/matchers/simd/kernels.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+using c2mm::matchers::simd::Compare;
+
+// Long enough to exercise the unrolled loop, the single vector loop and the
+// scalar tail for every vector width.
+constexpr std::size_t max_size = 70;
+
+template <typename T>
+std::vector<T> iota (std::size_t size) {
+    std::vector<T> values(size);
+    std::iota(values.begin(), values.end(), T{1});
+    return values;
+}
+}  // namespace
+
+TEMPLATE_TEST_CASE (
+    "c2mm::matchers::simd kernels",
+    "",
+    float,
+    double,
+    std::int16_t,
+    std::int32_t,
+    std::int64_t,
+    std::uint8_t
+) {
+    using namespace c2mm::matchers::simd;
+
+    SECTION ("all_compare agrees with the scalar comparison at every size") {
+        for (std::size_t size = 0; size <= max_size; ++size) {
+            auto const values = iota<TestType>(size);
+            auto const top = static_cast<TestType>(size);
+            CAPTURE(size);
+
+            CHECK(all_compare<Compare::less_equal>(values.data(), size, top));
+            CHECK(all_compare<Compare::greater>(
+                values.data(),
+                size,
+                TestType{0}
+            ));
+            CHECK(all_compare<Compare::not_equal>(
+                values.data(),
+                size,
+                TestType{0}
+            ));
+            CHECK(all_compare<Compare::less>(values.data(), size, top) ==
+                (size == 0));
+            CHECK(all_compare<Compare::equal>(values.data(), size, top) ==
+                (size <= 1));
+            CHECK(all_compare<Compare::greater_equal>(
+                values.data(),
+                size,
+                top
+            ) == (size <= 1));
+        }
+    }
+
+    SECTION ("all_compare finds a failing element at any position") {
+        for (std::size_t idx = 0; idx < max_size; ++idx) {
+            std::vector<TestType> values(max_size, TestType{3});
+            values[idx] = TestType{5};
+            CAPTURE(idx);
+
+            CHECK(not all_compare<Compare::less>(
+                values.data(),
+                values.size(),
+                TestType{4}
+            ));
+            CHECK(all_compare<Compare::less>(
+                values.data(),
+                idx,
+                TestType{4}
+            ));
+        }
+    }
+
+    SECTION ("all_equal finds a difference at any position") {
+        auto const values = iota<TestType>(max_size);
+        for (std::size_t idx = 0; idx < max_size; ++idx) {
+            auto other = values;
+            other[idx] = TestType{0};
+            CAPTURE(idx);
+
+            CHECK(all_equal(values.data(), values.data(), idx + 1));
+            CHECK(not all_equal(values.data(), other.data(), max_size));
+            CHECK(all_equal(values.data(), other.data(), idx));
+        }
+    }
+
+    SECTION ("max_abs_diff finds the largest difference at any position") {
+        auto const values = iota<TestType>(max_size);
+        for (std::size_t idx = 0; idx < max_size; ++idx) {
+            auto other = values;
+            other[idx] += TestType{7};
+            CAPTURE(idx);
+
+            CHECK(max_abs_diff(values.data(), other.data(), max_size) == 7);
+            CHECK(max_abs_diff(other.data(), values.data(), max_size) == 7);
+            CHECK(max_abs_diff(values.data(), other.data(), idx) == 0);
+        }
+    }
+
+    SECTION ("all_within finds an element out of tolerance at any position") {
+        for (std::size_t idx = 0; idx < max_size; ++idx) {
+            std::vector<TestType> values(max_size, TestType{10});
+            values[idx] = TestType{13};
+            CAPTURE(idx);
+
+            CHECK(all_within(values.data(), max_size, TestType{11}, 2));
+            CHECK(not all_within(values.data(), max_size, TestType{11}, 1));
+            CHECK(all_within(values.data(), idx, TestType{11}, 1));
+        }
+    }
+}
+
+TEST_CASE ("c2mm::matchers::simd kernels - edge cases") {
+    using namespace c2mm::matchers::simd;
+
+    SECTION ("integer differences never overflow") {
+        std::vector<std::int16_t> const low(20, INT16_MIN);
+        std::vector<std::int16_t> const high(20, INT16_MAX);
+        CHECK(max_abs_diff(low.data(), high.data(), 20) == UINT16_MAX);
+        CHECK(all_within(low.data(), 20, std::int16_t{INT16_MAX}, UINT16_MAX));
+        CHECK(not all_within(
+            low.data(),
+            20,
+            std::int16_t{INT16_MAX},
+            UINT16_MAX - 1
+        ));
+    }
+
+    SECTION ("NaN fails every comparison except inequality") {
+        constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+        for (std::size_t idx : {0u, 5u, 33u, 68u}) {
+            std::vector<float> values(max_size, 1.0f);
+            values[idx] = nan;
+            CAPTURE(idx);
+
+            CHECK(not all_compare<Compare::less_equal>(
+                values.data(),
+                max_size,
+                2.0f
+            ));
+            CHECK(not all_compare<Compare::greater_equal>(
+                values.data(),
+                max_size,
+                0.0f
+            ));
+            CHECK(all_compare<Compare::not_equal>(
+                values.data(),
+                max_size,
+                2.0f
+            ));
+            CHECK(not all_equal(values.data(), values.data(), max_size));
+            CHECK(not all_within(values.data(), max_size, 1.0f, 10.0f));
+
+            std::vector<float> const ones(max_size, 1.0f);
+            CHECK(std::isnan(max_abs_diff(
+                values.data(),
+                ones.data(),
+                max_size
+            )));
+        }
+    }
+
+    SECTION ("signed zeros are equal") {
+        std::vector<double> const positive(9, 0.0);
+        std::vector<double> const negative(9, -0.0);
+        CHECK(all_equal(positive.data(), negative.data(), 9));
+        CHECK(max_abs_diff(positive.data(), negative.data(), 9) == 0.0);
+    }
+}
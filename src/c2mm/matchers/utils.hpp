@@ -1,19 +1,32 @@
 #ifndef C2MM__MATCHERS_UTILS_HPP_
 #define C2MM__MATCHERS_UTILS_HPP_
 
+#include <ranges>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
+#ifdef C2MM_NO_CATCH2
+#include <ostream>
+#include <sstream>
+#else
 #include <catch2/catch_tostring.hpp>
-#include <catch2/matchers/catch_matchers.hpp>
+#endif
+
+#include "c2mm/matchers/Matcher_Base.hpp"
+#include "c2mm/matchers/Predicate_Description.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/cx/utils.hpp"
 
 namespace c2mm::matchers::utils {
 /**
- * Type trait identifying whether or not @p T is a matcher.
+ * Type trait identifying whether or not @p T is a matcher: a runtime matcher,
+ * such as a Catch2 matcher, or a constexpr matcher.
  */
 template <typename T>
-struct is_matcher : public std::integral_constant<
-    bool,
-    std::is_base_of_v<Catch::Matchers::MatcherUntypedBase, T>
+struct is_matcher : public std::disjunction<
+    std::is_base_of<Untyped_Matcher_Base, T>,
+    cx::utils::is_matcher<T>
 > {};
 
 template <typename T>
@@ -53,6 +66,88 @@ inline constexpr auto matches = [] (
     }
 };
 
+/**
+ * Convert @p value to a string for a description.
+ *
+ * This uses Catch2's stringification utilities, so specializations of @c
+ * Catch::StringMaker apply. If @c C2MM_NO_CATCH2 is defined, as it is for the
+ * @c c2mm::core target, Catch2 is not included and strings are quoted, ranges
+ * are listed and other values are streamed if they can be.
+ *
+ * @param[in] value The value to convert.
+ *
+ * @return A string representing @p value.
+ */
+template <typename T>
+std::string stringify (T const& value) {
+#ifdef C2MM_NO_CATCH2
+    if constexpr (std::is_same_v<T, bool>) {
+        return value ? "true" : "false";
+    } else if constexpr (std::is_same_v<T, char>) {
+        return std::string{'\'', value, '\''};
+    } else if constexpr (std::is_convertible_v<T const&, std::string_view>) {
+        return '"' + std::string{std::string_view{value}} + '"';
+    } else if constexpr (requires (std::ostream& out) { out << value; }) {
+        std::ostringstream out{};
+        out << value;
+        return out.str();
+    } else if constexpr (std::ranges::input_range<T const>) {
+        std::string description{"{ "};
+        bool is_first = true;
+        for (auto const& element : value) {
+            if (not is_first) {
+                description += ", ";
+            }
+            description += stringify(element);
+            is_first = false;
+        }
+        return description + " }";
+    } else {
+        return "{?}";
+    }
+#else
+    return ::Catch::Detail::stringify(value);
+#endif
+}
+
+/**
+ * Describe a comparison of values to @p expected with a predicate described
+ * by @p pred_description, e.g. "< 5".
+ *
+ * @param[in] pred_description Description of the predicate.
+ * @param[in] predicate The predicate. Not described itself.
+ * @param[in] expected The expected value.
+ *
+ * @return The description of the predicate followed by @p expected.
+ */
+template <typename T_Binary_Pred, typename T_Expected>
+std::string describe_comparison (
+    std::string_view pred_description,
+    T_Binary_Pred const&,
+    T_Expected const& expected
+) {
+    std::string description{pred_description};
+    description += stringify(expected);
+    return description;
+}
+
+/**
+ * Describe a comparison of values to @p expected within a tolerance, e.g.
+ * "within 2 of 1".
+ */
+template <typename T_Tolerance, typename T_Expected>
+std::string describe_comparison (
+    std::string_view pred_description,
+    cx::Within_Tolerance<T_Tolerance> const& predicate,
+    T_Expected const& expected
+) {
+    std::string description{pred_description};
+    description += stringify(predicate.tolerance);
+    description += " of ";
+    description += stringify(expected);
+    return description;
+}
+
 /**
  * Describe the @p constraint either as a matcher or an explicit value.
  *
@@ -64,8 +159,10 @@ inline constexpr auto matches = [] (
  * @code
  *     constraint.describe()
  * @endcode
- * Otherwise, this uses Catch2's stringification utilities to convert @p
- * constraint to a string.
+ * or to @c constraint.toString() if its @c describe is not accessible. A
+ * constexpr comparison with a @c Predicate_Description is described like a
+ * @c Comparison_Matcher. Other constexpr matchers have no description.
+ * Otherwise, @p constraint is converted to a string with @c stringify.
  *
  * @param[in] constraint Either a matcher or a value.
  *
@@ -74,10 +171,28 @@ inline constexpr auto matches = [] (
 inline constexpr auto describe = [] (auto const& constraint) -> std::string {
     using Constraint = std::remove_cvref_t<decltype(constraint)>;
 
-    if constexpr (is_matcher_v<Constraint>) {
-        return constraint.describe();
+    if constexpr (cx::utils::is_matcher_v<Constraint>) {
+        if constexpr (requires {
+            Predicate_Description<typename Constraint::Predicate>::value;
+            constraint.expected();
+        }) {
+            return describe_comparison(
+                Predicate_Description<typename Constraint::Predicate>::value,
+                constraint.predicate(),
+                constraint.expected()
+            );
+        } else {
+            return "";
+        }
+    } else if constexpr (is_matcher_v<Constraint>) {
+        // Catch2's matchers may keep describe protected.
+        if constexpr (requires { constraint.describe(); }) {
+            return constraint.describe();
+        } else {
+            return constraint.toString();
+        }
     } else {
-        return ::Catch::Detail::stringify(constraint);
+        return stringify(constraint);
     }
 };
 }  // namespace c2mm::matchers::utils
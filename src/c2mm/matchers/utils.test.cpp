@@ -1,8 +1,24 @@
 #include "c2mm/matchers/utils.hpp"
 
+#include <string>
+
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
 
 #include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/cx/Tuple.hpp"
+
+namespace {
+// A matcher written against Catch2 alone, which keeps describe protected.
+class Is_Even final : public Catch::Matchers::MatcherBase<int> {
+  public:
+    bool match (int const& value) const override { return value % 2 == 0; }
+
+  protected:
+    std::string describe () const override { return "is even"; }
+};
+}  // namespace
 
 TEST_CASE ("utils::is_matcher") {
     using c2mm::matchers::equal_to;
@@ -11,6 +27,8 @@ TEST_CASE ("utils::is_matcher") {
     CHECK(not is_matcher_v<bool>);
     CHECK(not is_matcher_v<double>);
     CHECK(is_matcher_v<decltype(equal_to(7.2))>);
+    CHECK(is_matcher_v<decltype(c2mm::matchers::cx::equal_to(7.2))>);
+    CHECK(is_matcher_v<Is_Even>);
 }
 
 TEST_CASE ("utils::matches") {
@@ -22,6 +40,9 @@ TEST_CASE ("utils::matches") {
     CHECK(not matches(3.21, less_or_equal_to(3.2)));
     CHECK(matches(3, 3.0));
     CHECK(not matches(3.1, 3));
+    CHECK(matches(3, c2mm::matchers::cx::less_than(3.2)));
+    CHECK(matches(4, Is_Even{}));
+    CHECK(not matches(3, Is_Even{}));
 }
 
 TEST_CASE ("utils::describe") {
@@ -30,4 +51,7 @@ TEST_CASE ("utils::describe") {
 
     CHECK(describe(greater_than(-4)) == "> -4");
     CHECK(describe(-4) == "-4");
+    CHECK(describe(c2mm::matchers::cx::greater_than(-4)) == "> -4");
+    CHECK(describe(c2mm::matchers::cx::tuple(1, 2)) == "");
+    CHECK(describe(Is_Even{}) == "is even");
 }
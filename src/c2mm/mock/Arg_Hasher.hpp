@@ -0,0 +1,219 @@
+#ifndef C2MM__MOCK__ARG_HASHER_HPP_
+#define C2MM__MOCK__ARG_HASHER_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/matchers/utils.hpp"
+
+namespace c2mm::mock {
+namespace impl_ {
+template <typename T>
+struct is_basic_string : std::false_type {};
+
+template <typename T_Char, typename T_Traits, typename T_Alloc>
+struct is_basic_string<std::basic_string<T_Char, T_Traits, T_Alloc>>
+      : std::true_type {};
+
+/**
+ * Extracts the value a constraint requires an argument to be equal to. The
+ * primary template handles plain values.
+ */
+template <typename T_Constraint>
+struct Exact_Value {
+    static constexpr bool exists =
+        not matchers::utils::is_matcher_v<T_Constraint>;
+
+    static T_Constraint const& get (T_Constraint const& constraint) {
+        return constraint;
+    }
+};
+
+template <typename T_Expected>
+struct Exact_Value<matchers::Comparison_Matcher<T_Expected, std::equal_to<>>> {
+    static constexpr bool exists = true;
+
+    static T_Expected const& get (auto const& constraint) {
+        return constraint.expected();
+    }
+};
+
+template <typename T_Expected>
+struct Exact_Value<matchers::cx::Comparison<T_Expected, std::equal_to<>>> {
+    static constexpr bool exists = true;
+
+    static T_Expected const& get (auto const& constraint) {
+        return constraint.expected();
+    }
+};
+
+/**
+ * Whether a parameter of type @p T_Param which is equal to a value of type @p
+ * T_Value always hashes the same as that value converted to @p T_Param.
+ */
+template <typename T_Param, typename T_Value>
+constexpr bool is_hash_indexable () {
+    if constexpr (is_basic_string<T_Param>::value) {
+        return std::is_convertible_v<
+            T_Value const&,
+            std::basic_string_view<
+                typename T_Param::value_type,
+                typename T_Param::traits_type
+            >
+        >;
+    } else if constexpr (std::is_enum_v<T_Param>) {
+        return std::is_same_v<T_Param, T_Value>;
+    } else {
+        return std::is_integral_v<T_Param> and std::is_integral_v<T_Value>;
+    }
+}
+
+template <typename T_Param, typename T_Constraint>
+constexpr bool is_exact_indexable () {
+    using Exact = Exact_Value<T_Constraint>;
+    if constexpr (Exact::exists) {
+        using Value = std::remove_cvref_t<
+            decltype(Exact::get(std::declval<T_Constraint const&>()))
+        >;
+        return is_hash_indexable<T_Param, Value>();
+    } else {
+        return false;
+    }
+}
+
+template <typename T_Param, typename T_Value>
+std::size_t hash_as (T_Value const& value) {
+    if constexpr (is_basic_string<T_Param>::value) {
+        using View = std::basic_string_view<
+            typename T_Param::value_type,
+            typename T_Param::traits_type
+        >;
+        return std::hash<View>{}(value);
+    } else {
+        return std::hash<T_Param>{}(static_cast<T_Param>(value));
+    }
+}
+
+inline std::size_t hash_combine (std::size_t seed, std::size_t hash) {
+    return seed ^ (hash + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+}
+}  // namespace impl_
+
+/**
+ * Hashes the arguments of calls to a function so that calls and constraints
+ * requiring exact argument values can be paired up by hash lookup.
+ *
+ * A set of constraints can be hashed when every constraint is an exact value
+ * (a plain value or @c equal_to) of a type which hashes the same as the
+ * corresponding parameter: integral, enum or string parameters. Any arguments
+ * which satisfy such a set of constraints hash the same as the constraints.
+ *
+ * @tparam T_Parameters Types of the function's parameters.
+ */
+template <typename... T_Parameters>
+struct Arg_Hasher {
+    /**
+     * Whether arguments can be hashed with @c hash_args. Only then can any
+     * constraints be hashed.
+     */
+    static constexpr bool can_hash_args = (impl_::is_hash_indexable<
+        std::remove_cvref_t<T_Parameters>,
+        std::remove_cvref_t<T_Parameters>
+    >() and ...);
+
+    /**
+     * Whether constraints of types @p T_Constraints can be hashed with @c
+     * hash_constraints.
+     */
+    template <typename... T_Constraints>
+    static constexpr bool can_hash_constraints () {
+        if constexpr (sizeof...(T_Constraints) != sizeof...(T_Parameters)) {
+            return false;
+        } else {
+            return (impl_::is_exact_indexable<
+                std::remove_cvref_t<T_Parameters>,
+                std::remove_cvref_t<T_Constraints>
+            >() and ...);
+        }
+    }
+
+    /**
+     * Whether the elements of the tuple-like @p T_Set can be hashed with @c
+     * hash_constraints.
+     */
+    template <typename T_Set>
+    static constexpr bool can_hash_constraint_set () {
+        return [] <std::size_t... t_idxs> (std::index_sequence<t_idxs...>) {
+            return can_hash_constraints<
+                std::tuple_element_t<t_idxs, T_Set>...
+            >();
+        }(std::make_index_sequence<std::tuple_size_v<T_Set>>{});
+    }
+
+    /**
+     * Hash a set of exact value constraints.
+     * @param[in] constraints... One constraint per parameter.
+     * @return The hash any arguments satisfying @p constraints have.
+     */
+    template <typename... T_Constraints>
+        requires (can_hash_constraints<T_Constraints...>())
+    static std::size_t hash_constraints (T_Constraints const&... constraints) {
+        using std::remove_cvref_t;
+        using impl_::Exact_Value;
+
+        std::size_t seed = 0;
+        ((seed = impl_::hash_combine(
+            seed,
+            impl_::hash_as<remove_cvref_t<T_Parameters>>(
+                Exact_Value<T_Constraints>::get(constraints)
+            )
+        )), ...);
+        return seed;
+    }
+
+    /**
+     * Hash the arguments of a call.
+     * @param[in] args Tuple of the arguments, either bound or captured.
+     * @return The hash of the arguments.
+     */
+    template <typename T_Args_Tuple>
+        requires can_hash_args
+    static std::size_t hash_args (T_Args_Tuple const& args) {
+        return std::apply(
+            [] (auto const&... values) {
+                std::size_t seed = 0;
+                ((seed = impl_::hash_combine(
+                    seed,
+                    impl_::hash_as<std::remove_cvref_t<T_Parameters>>(values)
+                )), ...);
+                return seed;
+            },
+            args
+        );
+    }
+};
+
+/**
+ * Type trait mapping a @c std::tuple of argument types to the @c Arg_Hasher
+ * for those types.
+ */
+template <typename T_Args_Tuple>
+struct arg_hasher_for;
+
+template <typename... T_Args>
+struct arg_hasher_for<std::tuple<T_Args...>> {
+    using type = Arg_Hasher<T_Args...>;
+};
+
+template <typename T_Args_Tuple>
+using arg_hasher_for_t = typename arg_hasher_for<T_Args_Tuple>::type;
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__ARG_HASHER_HPP_
@@ -0,0 +1,178 @@
+#ifndef C2MM__MOCK__ASYNC_EXPECTATION_HPP_
+#define C2MM__MOCK__ASYNC_EXPECTATION_HPP_
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/Inline_Matcher.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
+#include "c2mm/mock/Default_Action.hpp"
+#include "c2mm/mock/Pending_Call.hpp"
+#include "c2mm/mock/args.hpp"
+
+namespace c2mm::mock {
+/**
+ * Primary template for @c Async_Expectation is intentionally not defined.
+ *
+ * See specializations for full documentation.
+ */
+template <typename T_Signature>
+class Async_Expectation;
+
+/**
+ * Completes the calls to an @c Async_Mock_Function which it matches, as soon
+ * as they are made.
+ *
+ * By default a call is completed with the result of @c Default_Action. Use
+ * @c complete_with, @c fail_with or @c execute to change that. Like the
+ * expectations of @c Mock_Function::on_call, an @c Async_Expectation never
+ * saturates.
+ *
+ * @tparam T_Result The type of the result of the calls.
+ * @tparam T_Parameters Types of the mocked function's parameters.
+ */
+template <typename T_Result, typename... T_Parameters>
+class Async_Expectation<T_Result(T_Parameters...)> {
+  public:
+    using Args_Tuple = Bound_Args<T_Parameters...>;
+    using Matcher = matchers::Matcher_Base<Args_Tuple>;
+    using Matcher_Storage = matchers::Inline_Matcher<Args_Tuple>;
+    using Pending_Call_Type = Pending_Call<T_Result>;
+
+    /**
+     * Construct from required components.
+     *
+     * @param[in] matcher Tuple matcher indicating whether this completes a
+     *     call based on it's arguments.
+     */
+    Async_Expectation (Matcher_Storage matcher)
+          : matcher_{std::move(matcher)} {}
+
+    /**
+     * Read-only accessor to the internal matcher.
+     * @return Constant reference to the @c matcher field.
+     */
+    Matcher const& matcher () const {
+        return matcher_.base();
+    }
+
+    /**
+     * Number of calls completed so far.
+     */
+    std::size_t call_count () const { return call_count_; }
+
+    /**
+     * Always @c false. See the class documentation.
+     */
+    bool is_saturated () const { return false; }
+
+    /**
+     * Indicates whether this completes the call identified by @p args.
+     * @param[in] args Tuple of references to the arguments of the call.
+     * @return @c true if the matcher specified at construction matches @p
+     *     args.
+     */
+    bool can_consume (Args_Tuple const& args) const {
+        return matcher_.match(args);
+    }
+
+    /**
+     * Complete each call with a copy of a value constructed from @p args.
+     * @return This expectation, for chaining.
+     */
+    template <typename... T_Args>
+    Async_Expectation& complete_with (T_Args&&... args) {
+        complete_ = [
+            value = typename Pending_Call_Type::Value(
+                std::forward<T_Args>(args)...
+            )
+        ] (Pending_Call_Type& call, Args_Tuple const&) {
+            call.complete(value);
+        };
+        return *this;
+    }
+
+    /**
+     * Fail each call by rethrowing @p error in its caller.
+     * @param[in] error The exception to rethrow. Must not be null.
+     * @return This expectation, for chaining.
+     * @throws std::invalid_argument If @p error is null.
+     */
+    Async_Expectation& fail_with (std::exception_ptr error) {
+        if (not error) {
+            throw std::invalid_argument{"Cannot fail calls with no error."};
+        }
+        complete_ = [error = std::move(error)] (
+            Pending_Call_Type& call,
+            Args_Tuple const&
+        ) {
+            call.fail(error);
+        };
+        return *this;
+    }
+
+    /**
+     * Handle each call with @p action, which may complete the call or keep a
+     * copy of it to complete later.
+     *
+     * @p action is called without any lock held. If it keeps state and calls
+     * may be concurrent, it must synchronize that state itself.
+     *
+     * @param[in] action Callable invoked with the @c Pending_Call_Type and
+     *     then each argument of the call, by const l-value reference.
+     *
+     * @return This expectation, for chaining.
+     */
+    template <typename T_Action>
+    Async_Expectation& execute (T_Action&& action) {
+        complete_ = [action = std::forward<T_Action>(action)] (
+            Pending_Call_Type& call,
+            Args_Tuple const& args
+        ) mutable {
+            std::apply(
+                [&action, &call] (auto const&... arg_values) {
+                    std::invoke(action, call, arg_values...);
+                },
+                args
+            );
+        };
+        return *this;
+    }
+
+    /**
+     * Count a call this matched. Must be synchronized with other calls.
+     */
+    void record_call () { ++call_count_; }
+
+    /**
+     * Complete @p call, which this matched and recorded.
+     * @param[in] call The call to complete.
+     * @param[in] args Tuple of references to the arguments of the call.
+     */
+    void handle_call (Pending_Call_Type& call, Args_Tuple const& args) {
+        complete_(call, args);
+    }
+
+  private:
+    static void complete_default (Pending_Call_Type& call, Args_Tuple const&) {
+        if constexpr (std::is_void_v<T_Result>) {
+            call.complete();
+        } else {
+            call.complete(Default_Action<T_Result>{}());
+        }
+    }
+
+    Matcher_Storage matcher_;
+    std::function<void(Pending_Call_Type&, Args_Tuple const&)> complete_ =
+        complete_default;
+
+    std::size_t call_count_ = 0;
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__ASYNC_EXPECTATION_HPP_
@@ -0,0 +1,216 @@
+#ifndef C2MM__MOCK__ASYNC_MOCK_FUNCTION_HPP_
+#define C2MM__MOCK__ASYNC_MOCK_FUNCTION_HPP_
+
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "c2mm/mock/Async_Expectation.hpp"
+#include "c2mm/mock/Expectation_Set.hpp"
+#include "c2mm/mock/Mock_Function.hpp"
+#include "c2mm/mock/Pending_Call.hpp"
+#include "c2mm/mock/args.hpp"
+#include "c2mm/mock/capture/Value.hpp"
+#include "c2mm/mock/reporters/Fail_Check.hpp"
+#include "c2mm/mock/stats/None.hpp"
+#include "c2mm/mock/storage/Heap.hpp"
+#include "c2mm/mock/threading/Single_Threaded.hpp"
+
+#define FWD(X) std::forward<decltype(X)>(X)
+
+namespace c2mm::mock {
+/**
+ * Primary template for @c Async_Mock_Function is intentionally not defined.
+ *
+ * See specializations for full documentation.
+ */
+template <
+    typename T_Signature,
+    typename T_Log_Reporter = reporters::Fail_Check,
+    typename T_Log_Storage = storage::Heap,
+    typename T_Threading = threading::Single_Threaded,
+    typename T_Capture = capture::Value,
+    typename T_Stats = stats::None
+>
+class Async_Mock_Function;
+
+/**
+ * A mock of an asynchronous function, whose calls are @c co_await ed.
+ *
+ * Each call returns an @c Async_Result which completes when the test or an
+ * expectation says so. Calls are logged and verified exactly as with a @c
+ * Mock_Function of the same parameters, whose members are all available.
+ *
+ * A call which matches an expectation added with @c on_call is completed by
+ * it as soon as it is made, unless its action keeps the call to complete
+ * later. Every other call stays pending until the test completes it through
+ * one of the @c pending_calls. A test can thus hold many
+ * calls suspended at once and complete them in any order, all on one thread.
+ *
+ * If an executor is set, coroutines awaiting calls are resumed by it rather
+ * than inline. See @c set_executor.
+ *
+ * @tparam T_Result The type of the result of awaiting a call.
+ * @tparam T_Parameters Types of the mocked function's parameters.
+ * @tparam T_Log_Reporter See @c Mock_Function.
+ * @tparam T_Log_Storage See @c Mock_Function.
+ * @tparam T_Threading See @c Mock_Function. Calls may be made concurrently,
+ *     but each call must be completed on the thread which awaits it.
+ * @tparam T_Capture See @c Mock_Function.
+ * @tparam T_Stats See @c Mock_Function.
+ */
+template <
+    typename T_Result,
+    typename... T_Parameters,
+    typename T_Log_Reporter,
+    typename T_Log_Storage,
+    typename T_Threading,
+    typename T_Capture,
+    typename T_Stats
+>
+class Async_Mock_Function<
+    T_Result(T_Parameters...),
+    T_Log_Reporter,
+    T_Log_Storage,
+    T_Threading,
+    T_Capture,
+    T_Stats
+> : public Mock_Function<
+    void(T_Parameters...),
+    T_Log_Reporter,
+    T_Log_Storage,
+    T_Threading,
+    T_Capture,
+    T_Stats
+> {
+    using Base = Mock_Function<
+        void(T_Parameters...),
+        T_Log_Reporter,
+        T_Log_Storage,
+        T_Threading,
+        T_Capture,
+        T_Stats
+    >;
+
+  public:
+    using Signature = Async_Result<T_Result>(T_Parameters...);
+    using Pending_Call_Type = Pending_Call<T_Result>;
+    using Async_Expectation_Type = Async_Expectation<T_Result(T_Parameters...)>;
+
+    /**
+     * Construct an instance with a given reporter.
+     * @param[in] reporter Callable used to report failures (unconsumed calls).
+     * @param[in] resource Memory resource from which logged calls,
+     *     expectations and pending calls are allocated. Must outlive this
+     *     object.
+     */
+    explicit Async_Mock_Function (
+        T_Log_Reporter reporter = T_Log_Reporter{},
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : Base{std::move(reporter), resource},
+        completions_{resource},
+        pending_{resource} {}
+
+    /**
+     * Construct an instance with the default reporter which allocates from
+     * @p resource.
+     * @param[in] resource Memory resource from which logged calls,
+     *     expectations and pending calls are allocated. Must outlive this
+     *     object.
+     */
+    explicit Async_Mock_Function (std::pmr::memory_resource* resource)
+          : Async_Mock_Function{T_Log_Reporter{}, resource} {}
+
+    /**
+     * Resume coroutines awaiting calls made from now on with @p executor, e.g.
+     * to queue them on an event loop the test drives. An empty executor, the
+     * default, resumes them inline from wherever the call is completed.
+     */
+    void set_executor (Executor executor) { executor_ = std::move(executor); }
+
+    /**
+     * Complete calls that match @p arg_constraints as soon as they are made.
+     *
+     * Each call is completed by the first such expectation, in the order they
+     * were added, whose constraints it satisfies. The call is still logged
+     * or handled as by @c Mock_Function.
+     *
+     * @param[in] arg_constraints... Constraints on individual arguments. In
+     *     order for an expectation to apply, all arguments must satisfy their
+     *     respective constraints.
+     *
+     * @return The expectation, to configure how it completes calls.
+     */
+    template <typename... T_Constraints>
+    Async_Expectation_Type& on_call (T_Constraints&&... arg_constraints) {
+        return completions_.add(FWD(arg_constraints)...);
+    }
+
+    /**
+     * "Call" the mock function.
+     *
+     * The call is handled by the first matching expectation added with @c
+     * on_call, if any, then logged or handled as by @c Mock_Function. A call
+     * which the expectation does not complete, or which matches none, is
+     * pending until completed through @c pending_calls. Expectations handle
+     * calls without any lock held.
+     *
+     * @param[in] args The arguments of the call.
+     *
+     * @return The awaitable result of the call.
+     */
+    Async_Result<T_Result> operator () (T_Parameters&&... args) {
+        Pending_Call_Type call{executor_};
+        Async_Expectation_Type* completion = nullptr;
+
+        {
+            std::scoped_lock lock{mutex_};
+            if (not completions_.empty()) {
+                completion = completions_.find(bind_args(args...));
+            }
+            if (completion) {
+                completion->record_call();
+            } else {
+                pending_.push_back(call);
+            }
+        }
+
+        // Nothing awaits the call yet, so completing it resumes nothing.
+        if (completion) {
+            completion->handle_call(call, bind_args(args...));
+            if (not call.is_done()) {
+                std::scoped_lock lock{mutex_};
+                pending_.push_back(call);
+            }
+        }
+
+        Base::operator()(FWD(args)...);
+        return call.result();
+    }
+
+    /**
+     * The calls which are not complete yet, oldest first.
+     *
+     * Completing one of them resumes the coroutine awaiting it, if any.
+     */
+    std::vector<Pending_Call_Type> pending_calls () {
+        std::scoped_lock lock{mutex_};
+        std::erase_if(pending_, [] (Pending_Call_Type const& call) {
+            return call.is_done();
+        });
+        return {pending_.begin(), pending_.end()};
+    }
+
+  private:
+    Expectation_Set<T_Result(T_Parameters...), Async_Expectation_Type>
+        completions_;
+    std::pmr::vector<Pending_Call_Type> pending_;
+    Executor executor_{};
+    [[no_unique_address]] typename T_Threading::Mutex mutex_;
+};
+}  // namespace c2mm::mock
+
+#undef FWD
+
+#endif  // C2MM__MOCK__ASYNC_MOCK_FUNCTION_HPP_
@@ -0,0 +1,302 @@
+#include "c2mm/mock/Async_Mock_Function.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/mock/storage/Chunked.hpp"
+#include "c2mm/mock/threading/Multi_Threaded.hpp"
+
+namespace {
+// Minimal eagerly started coroutine which keeps its frame until destroyed.
+struct Task {
+    struct promise_type {
+        Task get_return_object () {
+            return Task{
+                std::coroutine_handle<promise_type>::from_promise(*this)
+            };
+        }
+        std::suspend_never initial_suspend () noexcept { return {}; }
+        std::suspend_always final_suspend () noexcept { return {}; }
+        void return_void () {}
+        void unhandled_exception () { std::terminate(); }
+    };
+
+    explicit Task (std::coroutine_handle<promise_type> handle)
+          : handle{handle} {}
+    Task (Task&& other) : handle{std::exchange(other.handle, nullptr)} {}
+    ~Task () {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    bool done () const { return handle.done(); }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+using Lookup = c2mm::mock::Async_Mock_Function<std::string(int)>;
+
+Task lookup (Lookup& func, int key, std::optional<std::string>& result) {
+    try {
+        result = co_await func(int{key});
+    } catch (std::runtime_error const& error) {
+        result = std::string{"error: "} + error.what();
+    }
+}
+}  // namespace
+
+SCENARIO ("An Async_Mock_Function suspends callers until calls complete.") {
+    GIVEN ("an Async_Mock_Function with several suspended callers") {
+        Lookup func{};
+        std::vector<std::optional<std::string>> results(3);
+        std::vector<Task> tasks{};
+        for (int key = 0; key < 3; ++key) {
+            tasks.push_back(lookup(func, key, results[key]));
+        }
+
+        THEN ("every call is pending and awaited") {
+            auto const pending = func.pending_calls();
+            REQUIRE(pending.size() == 3);
+            for (auto const& call : pending) {
+                CHECK(call.is_awaited());
+                CHECK(not call.is_done());
+            }
+            CHECK(not tasks[0].done());
+            func.check_all_called(std::vector{
+                std::tuple{0},
+                std::tuple{1},
+                std::tuple{2},
+            });
+        }
+
+        WHEN ("the test completes them out of order") {
+            auto pending = func.pending_calls();
+            pending[2].complete("two");
+            pending[0].fail(std::make_exception_ptr(
+                std::runtime_error{"zero"}
+            ));
+
+            THEN ("only those callers resume") {
+                CHECK(tasks[2].done());
+                CHECK(results[2] == "two");
+                CHECK(tasks[0].done());
+                CHECK(results[0] == "error: zero");
+                CHECK(not tasks[1].done());
+                CHECK(func.pending_calls().size() == 1);
+                CHECK_THROWS_AS(
+                    pending[2].complete("again"),
+                    std::logic_error
+                );
+
+                func.pending_calls()[0].complete("one");
+                CHECK(results[1] == "one");
+                CHECK(func.pending_calls().empty());
+                func.check_call_count(3);
+            }
+        }
+    }
+}
+
+SCENARIO ("Async_Mock_Function expectations complete calls.") {
+    GIVEN ("an Async_Mock_Function with expectations") {
+        Lookup func{};
+        func.on_call(1).complete_with("one");
+        func.on_call(2).fail_with(std::make_exception_ptr(
+            std::runtime_error{"two"}
+        ));
+        func.on_call(3);
+
+        WHEN ("matching calls are awaited") {
+            std::optional<std::string> one{};
+            std::optional<std::string> two{};
+            std::optional<std::string> three{};
+            Task const t1 = lookup(func, 1, one);
+            Task const t2 = lookup(func, 2, two);
+            Task const t3 = lookup(func, 3, three);
+
+            THEN ("they complete without suspending") {
+                CHECK(t1.done());
+                CHECK(one == "one");
+                CHECK(t2.done());
+                CHECK(two == "error: two");
+                CHECK(t3.done());
+                CHECK(three == "");
+                CHECK(func.pending_calls().empty());
+                func.check_call_count(3);
+            }
+        }
+    }
+}
+
+SCENARIO ("Async_Mock_Function expectations may execute actions.") {
+    GIVEN ("an Async_Mock_Function with actions for some calls") {
+        Lookup func{};
+        std::vector<Lookup::Pending_Call_Type> kept{};
+        func.on_call(4).execute([] (auto& call, int key) {
+            call.complete(std::to_string(key * 2));
+        });
+        func.on_call(5).execute([&kept] (auto& call, int) {
+            kept.push_back(call);
+        });
+
+        WHEN ("a call is completed from its arguments") {
+            std::optional<std::string> four{};
+            Task const task = lookup(func, 4, four);
+
+            THEN ("it completes without suspending") {
+                CHECK(task.done());
+                CHECK(four == "8");
+                CHECK(func.pending_calls().empty());
+                func.check_called(4);
+            }
+        }
+
+        WHEN ("a call is kept by its action") {
+            std::optional<std::string> five{};
+            Task const task = lookup(func, 5, five);
+
+            THEN ("it is pending until completed") {
+                CHECK(not task.done());
+                REQUIRE(kept.size() == 1);
+                CHECK(func.pending_calls().size() == 1);
+
+                kept[0].complete("five");
+                CHECK(task.done());
+                CHECK(five == "five");
+                CHECK(func.pending_calls().empty());
+                func.check_call_count(1);
+            }
+        }
+    }
+}
+
+TEST_CASE ("Async_Mock_Function rejects failing calls with no error.") {
+    Lookup func{};
+    CHECK_THROWS_AS(func.on_call(1).fail_with(nullptr), std::invalid_argument);
+
+    std::optional<std::string> result{};
+    Task const task = lookup(func, 2, result);
+    CHECK_THROWS_AS(
+        func.pending_calls()[0].fail(nullptr),
+        std::invalid_argument
+    );
+    CHECK(not task.done());
+
+    func.pending_calls()[0].complete("two");
+    CHECK(result == "two");
+    func.check_called(2);
+}
+
+SCENARIO ("Async_Mock_Function expectations count concurrent calls.") {
+    using Func = c2mm::mock::Async_Mock_Function<
+        std::string(int),
+        c2mm::mock::reporters::Fail_Check,
+        c2mm::mock::storage::Chunked<>,
+        c2mm::mock::threading::Multi_Threaded<>
+    >;
+
+    GIVEN ("an Async_Mock_Function shared between threads") {
+        Func func{};
+        auto const& expectation = func.on_call(1).complete_with("one");
+
+        WHEN ("several threads make matching calls at once") {
+            constexpr int num_threads = 4;
+            constexpr int num_calls = 200;
+
+            // Catch2 assertions are not thread-safe.
+            std::atomic<int> num_completed{0};
+            auto const call = [] (Func& func, std::atomic<int>& num) -> Task {
+                if (co_await func(1) == "one") {
+                    ++num;
+                }
+            };
+
+            std::vector<std::thread> threads{};
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&func, &call, &num_completed] {
+                    for (int i = 0; i < num_calls; ++i) {
+                        Task const task = call(func, num_completed);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            THEN ("every call is counted") {
+                CHECK(num_completed == num_threads * num_calls);
+                CHECK(expectation.call_count() == num_threads * num_calls);
+                func.check_call_count(num_threads * num_calls);
+            }
+        }
+    }
+}
+
+SCENARIO ("Async_Mock_Function resumes callers on a given executor.") {
+    GIVEN ("an Async_Mock_Function with a queueing executor") {
+        Lookup func{};
+        std::deque<std::coroutine_handle<>> queue{};
+        func.set_executor([&queue] (std::coroutine_handle<> handle) {
+            queue.push_back(handle);
+        });
+        func.on_call(1).complete_with("one");
+
+        std::optional<std::string> one{};
+        std::optional<std::string> two{};
+        Task const t1 = lookup(func, 1, one);
+        Task const t2 = lookup(func, 2, two);
+
+        WHEN ("calls complete") {
+            func.pending_calls()[0].complete("two");
+
+            THEN ("callers resume only when the executor runs them") {
+                CHECK(not t1.done());
+                CHECK(not t2.done());
+                REQUIRE(queue.size() == 2);
+
+                while (not queue.empty()) {
+                    auto const handle = queue.front();
+                    queue.pop_front();
+                    handle.resume();
+                }
+                CHECK(one == "one");
+                CHECK(two == "two");
+                func.check_call_count(2);
+            }
+        }
+    }
+}
+
+SCENARIO ("An Async_Mock_Function may have no result.") {
+    GIVEN ("an Async_Mock_Function returning void") {
+        c2mm::mock::Async_Mock_Function<void(int)> func{};
+        bool resumed = false;
+        auto const notify = [&] () -> Task {
+            co_await func(7);
+            resumed = true;
+        };
+        Task const task = notify();
+
+        WHEN ("the call is completed") {
+            func.pending_calls()[0].complete();
+
+            THEN ("the caller resumes") {
+                CHECK(resumed);
+                CHECK(task.done());
+                func.check_called(7);
+            }
+        }
+    }
+}
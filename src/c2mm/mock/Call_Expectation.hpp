@@ -0,0 +1,118 @@
+#ifndef C2MM__MOCK__CALL_EXPECTATION_HPP_
+#define C2MM__MOCK__CALL_EXPECTATION_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "c2mm/matchers/Inline_Matcher.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
+#include "c2mm/mock/Cardinality.hpp"
+#include "c2mm/mock/args.hpp"
+
+namespace c2mm::mock {
+/**
+ * Primary template for @c Call_Expectation is intentionally not defined.
+ *
+ * See specializations for full documentation.
+ */
+template <typename T_Signature>
+class Call_Expectation;
+
+/**
+ * A call a mock function expects to receive, verified as calls arrive.
+ *
+ * Unlike an @c Expectation, this has no action. It only counts the calls it
+ * matches against a @c Cardinality, which is exactly one call unless
+ * changed. A call it matches is never logged.
+ *
+ * A @c Call_Expectation never saturates: it keeps matching calls after its
+ * maximum is reached so that each excess call can be reported as it happens.
+ *
+ * Calls are counted atomically, so concurrent calls may be counted without a
+ * lock.
+ */
+template <typename T_Return, typename... T_Parameters>
+class Call_Expectation<T_Return(T_Parameters...)> {
+  public:
+    using Args_Tuple = Bound_Args<T_Parameters...>;
+    using Matcher = matchers::Matcher_Base<Args_Tuple>;
+    using Matcher_Storage = matchers::Inline_Matcher<Args_Tuple>;
+
+    /**
+     * Construct from required components.
+     *
+     * @param[in] matcher Tuple matcher indicating whether a call is expected
+     *     based on it's arguments.
+     */
+    Call_Expectation (Matcher_Storage matcher)
+          : matcher_{std::move(matcher)} {}
+
+    /**
+     * Read-only accessor to the internal matcher.
+     * @return Constant reference to the @c matcher field.
+     */
+    Matcher const& matcher () const {
+        return matcher_.base();
+    }
+
+    /**
+     * The number of calls this expects.
+     */
+    Cardinality const& cardinality () const { return cardinality_; }
+
+    /**
+     * Change the number of calls this expects.
+     */
+    void set_cardinality (Cardinality cardinality) {
+        cardinality_ = cardinality;
+    }
+
+    /**
+     * Number of calls matched so far.
+     */
+    std::size_t call_count () const {
+        return call_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Always @c false. See the class documentation.
+     */
+    bool is_saturated () const { return false; }
+
+    /**
+     * Indicates whether the call identified by @p args is expected.
+     * @param[in] args Tuple of references to the arguments of the call.
+     * @return @c true if the matcher specified at construction matches @p
+     *     args.
+     */
+    bool can_consume (Args_Tuple const& args) const {
+        return matcher_.match(args);
+    }
+
+    /**
+     * Count a call this matched.
+     * @return @c false if the call exceeds the maximum of the cardinality.
+     */
+    bool record_call () {
+        return not cardinality_.is_saturated_by(
+            call_count_.fetch_add(1, std::memory_order_relaxed)
+        );
+    }
+
+    /**
+     * Indicates whether enough calls were matched to satisfy the cardinality.
+     */
+    bool is_satisfied () const {
+        return cardinality_.is_satisfied_by(call_count());
+    }
+
+  private:
+    Matcher_Storage matcher_;
+    Cardinality cardinality_ = Cardinality::exactly(1);
+
+    std::atomic<std::size_t> call_count_{0};
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__CALL_EXPECTATION_HPP_
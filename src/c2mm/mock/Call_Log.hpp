@@ -1,52 +1,123 @@
 #ifndef C2MOCK__MOCK__CALL_LOG_HPP_
 #define C2MOCK__MOCK__CALL_LOG_HPP_
 
-#include <algorithm>
-#include <memory>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
 #include <utility>
-#include <vector>
-
-#include <catch2/catch_test_macros.hpp>
 
 #include "c2mm/mock/reporters/Fail_Check.hpp"
+#include "c2mm/mock/storage/Heap.hpp"
 
 namespace c2mm::mock {
+/**
+ * Whether verifying several calls at once requires them to have been logged
+ * in a particular order.
+ *
+ * Each order has its own type so that verifying in order can be rejected at
+ * compile time for storage which does not keep calls in order.
+ */
+struct Call_Order {
+    /// Each set of constraints may match any logged call.
+    struct Any {};
+    /// Sets of constraints must match logged calls in the order given.
+    struct In_Order {};
+
+    static constexpr Any any{};
+    static constexpr In_Order in_order{};
+};
+
 /**
  * Represents a log of calls to some function.
  *
  * @tparam T_Arg_Tuple A @c std::tuple representing the arguments to the
  *     function in question.
  * @tparam T_Reporter Policy dictating how failures are reported.
+ * @tparam T_Storage Policy dictating how logged calls are stored. See the
+ *     policies in @c c2mm::mock::storage.
  */
-template <typename T_Arg_Tuple, typename T_Reporter = reporters::Fail_Check>
+template <
+    typename T_Arg_Tuple,
+    typename T_Reporter = reporters::Fail_Check,
+    typename T_Storage = storage::Heap
+>
 class Call_Log {
   public:
     using Arg_Tuple = T_Arg_Tuple;
-    using Call_List = std::vector<std::unique_ptr<Arg_Tuple const>>;
+    using Call_List = typename T_Storage::template List<Arg_Tuple>;
+
+    /**
+     * Whether calls are visited in the order they were logged. Storage
+     * policies whose lists do not keep that order declare a static @c
+     * keeps_order member which is @c false.
+     */
+    static constexpr bool keeps_order = [] {
+        if constexpr (requires { Call_List::keeps_order; }) {
+            return Call_List::keeps_order;
+        } else {
+            return true;
+        }
+    }();
 
     /**
      * Construct an instance with a given reporter.
      * @param[in] reporter Callable used to report failures (unconsumed calls).
+     * @param[in] resource Memory resource from which the storage policy
+     *     allocates logged calls. Must outlive this object.
      */
-    explicit Call_Log (T_Reporter reporter = T_Reporter{})
-          : reporter_{std::move(reporter)} {}
+    explicit Call_Log (
+        T_Reporter reporter = T_Reporter{},
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : reporter_{std::move(reporter)},
+        calls_{resource} {}
 
     /**
      * Read-only accessor for the unconsumed calls logged with this object.
+     * Iterating the result yields `Arg_Tuple const&`.
      */
     Call_List const& calls () const { return calls_; }
 
+    /**
+     * Mutable accessor for the underlying storage, for operations specific to
+     * a storage policy.
+     */
+    Call_List& storage () { return calls_; }
+
+    /**
+     * Accessor for the reporter, for other failures concerning the same calls.
+     */
+    T_Reporter& reporter () { return reporter_; }
+
+    /**
+     * Number of unconsumed calls logged with this object, including any the
+     * storage policy counted without capturing.
+     */
+    std::size_t size () const { return calls_.size(); }
+
+    /**
+     * Consume every logged call.
+     */
+    void clear () { calls_.clear(); }
+
+    /**
+     * Number of calls which the storage policy discarded before they could be
+     * consumed. Always zero for policies which never discard calls.
+     */
+    std::size_t dropped () const {
+        if constexpr (requires { calls_.dropped(); }) {
+            return calls_.dropped();
+        } else {
+            return 0;
+        }
+    }
+
     /**
      * Log a call with this object. This owns the new argument objects.
      * @param[in] args Arguments of the call to log.
      */
     template <typename... Args>
     void log (Args&&... args) {
-        calls_.emplace_back(
-            std::make_unique<Arg_Tuple>(
-                std::forward<Args>(args)...
-            )
-        );
+        calls_.emplace(std::forward<Args>(args)...);
     }
 
     /**
@@ -57,31 +128,60 @@ class Call_Log {
      */
     template <typename T_Arg_Matcher>
     bool consume_match (T_Arg_Matcher const& matcher) {
-        auto match = [&matcher] (auto const& call) {
-            return matcher.match(*call);
-        };
-        auto iter = std::ranges::find_if(calls_, match);
-
-        if (iter == calls_.end()) {
-            return false;
-        }
+        return calls_.erase_first([&matcher] (Arg_Tuple const& call) {
+            return matcher.match(call);
+        });
+    }
 
-        calls_.erase(iter);
-        return true;
+    /**
+     * Consume every call for which @p pred returns @c true, in a single pass
+     * over the log.
+     *
+     * @p pred is called exactly once per logged call, in the order the calls
+     * were logged, so it may keep state between calls. For example, it may
+     * record which of several matchers each consumed call matched.
+     *
+     * @param[in] pred Unary predicate accepting `Arg_Tuple const&`.
+     * @return The number of calls consumed.
+     */
+    template <typename T_Pred>
+    std::size_t consume_if (T_Pred&& pred) {
+        return calls_.erase_if(std::forward<T_Pred>(pred));
     }
 
     /**
      * Verifies that no unconsumed calls remain logged with this instance.
+     * Reports one failure per remaining captured call, one failure for any
+     * calls the storage policy counted without capturing and one failure if
+     * the storage policy discarded any calls.
      *
-     * This should only be called as part of a Catch2 @c TEST_CASE. It is a
-     * check-style verification where failure fails the test but continues
-     * executing.
+     * With the default reporter, this should only be called as part of a
+     * Catch2 @c TEST_CASE. It is a check-style verification where failure
+     * fails the test but continues executing.
      */
     void check_no_calls () {
+        std::size_t num_reported = 0;
         for (auto const& call : calls_) {
             (void)call;
             // TODO(emery): print out function name and arguments
             reporter_("unconsumed call");
+            ++num_reported;
+        }
+
+        // Calls the storage policy counted without capturing.
+        if (auto const num_uncaptured = calls_.size() - num_reported;
+            num_uncaptured > 0
+        ) {
+            reporter_(
+                std::to_string(num_uncaptured) + " unconsumed call(s)"
+            );
+        }
+
+        if (auto const num_dropped = dropped(); num_dropped > 0) {
+            reporter_(
+                std::to_string(num_dropped) +
+                " unconsumed call(s) dropped from the log"
+            );
         }
 
         calls_.clear();
@@ -10,6 +10,9 @@
 #include "c2mm/matchers/Tuple_Matcher.hpp"
 #include "c2mm/mock/Mock_Function.hpp"
 #include "c2mm/mock/reporters/Mock.hpp"
+#include "c2mm/mock/storage/Chunked.hpp"
+#include "c2mm/mock/storage/Ring.hpp"
+#include "c2mm/mock/storage/Sharded.hpp"
 
 SCENARIO (
     "If all calls are consumed, Call_Log::check_no_calls() doesn't fail."
@@ -64,3 +67,109 @@ SCENARIO ("If some calls are unconsumed, Call_Log::check_no_calls() fails.") {
         }
     }
 }
+
+SCENARIO ("Call_Log with chunked storage consumes calls.") {
+    using c2mm::mock::Call_Log;
+    using c2mm::mock::storage::Chunked;
+
+    GIVEN ("a Call_Log with chunked storage") {
+        using Test_Call_Log = Call_Log<
+            std::tuple<int, std::string>,
+            reporters::Mock_Ref,
+            Chunked<2>
+        >;
+
+        reporters::Mock mock_reporter{};
+        Test_Call_Log call_log{std::ref(mock_reporter)};
+
+        WHEN ("some calls are logged") {
+            call_log.log(1, "one");
+            call_log.log(2, "two");
+            call_log.log(3, "three");
+
+            AND_WHEN ("not all calls are matched") {
+                using c2mm::matchers::matches;
+                CHECK(call_log.consume_match(matches(std::tuple{2, "two"})));
+                CHECK(call_log.consume_match(matches(std::tuple{1, "one"})));
+                CHECK(not call_log.consume_match(matches(std::tuple{1, "one"})));
+
+                THEN ("the remaining calls are still logged") {
+                    CHECK(call_log.calls().size() == 1);
+                    CHECK(*call_log.calls().begin() == std::tuple{3, "three"});
+                }
+
+                THEN ("Call_Log::check_no_calls() fails (once)") {
+                    call_log.check_no_calls();
+                    mock_reporter.check_called("unconsumed call");
+                }
+            }
+        }
+    }
+}
+
+SCENARIO ("Call_Log with ring storage reports dropped calls.") {
+    using c2mm::mock::Call_Log;
+    using c2mm::mock::storage::Ring;
+
+    GIVEN ("a Call_Log with ring storage") {
+        using Test_Call_Log = Call_Log<
+            std::tuple<int>,
+            reporters::Mock_Ref,
+            Ring<2>
+        >;
+
+        reporters::Mock mock_reporter{};
+        Test_Call_Log call_log{std::ref(mock_reporter)};
+
+        WHEN ("more calls are logged than it can hold") {
+            for (int i = 0; i < 5; ++i) {
+                call_log.log(i);
+            }
+
+            THEN ("the oldest calls are dropped") {
+                using c2mm::matchers::matches;
+                CHECK(call_log.dropped() == 3);
+                CHECK(not call_log.consume_match(matches(std::tuple{0})));
+                CHECK(call_log.consume_match(matches(std::tuple{3})));
+            }
+
+            THEN ("Call_Log::check_no_calls() reports the dropped calls") {
+                call_log.check_no_calls();
+                mock_reporter.check_called("unconsumed call");
+                mock_reporter.check_called("unconsumed call");
+                mock_reporter.check_called(
+                    "3 unconsumed call(s) dropped from the log"
+                );
+                CHECK(call_log.dropped() == 0);
+            }
+        }
+    }
+
+    GIVEN ("a Call_Log with sharded ring storage") {
+        using Test_Call_Log = Call_Log<
+            std::tuple<int>,
+            reporters::Mock_Ref,
+            c2mm::mock::storage::Sharded<Ring<4>>
+        >;
+
+        reporters::Mock mock_reporter{};
+        Test_Call_Log call_log{std::ref(mock_reporter)};
+
+        WHEN ("more calls are logged than a shard can hold") {
+            for (int i = 0; i < 10; ++i) {
+                call_log.log(i);
+            }
+
+            THEN ("Call_Log::check_no_calls() reports the dropped calls") {
+                CHECK(call_log.dropped() == 6);
+                call_log.check_no_calls();
+                for (int i = 0; i < 4; ++i) {
+                    mock_reporter.check_called("unconsumed call");
+                }
+                mock_reporter.check_called(
+                    "6 unconsumed call(s) dropped from the log"
+                );
+            }
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#ifndef C2MM__MOCK__CARDINALITY_HPP_
+#define C2MM__MOCK__CARDINALITY_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace c2mm::mock {
+/**
+ * The range of how many calls an expectation allows.
+ */
+class Cardinality {
+  public:
+    static constexpr std::size_t unbounded =
+        std::numeric_limits<std::size_t>::max();
+
+    /**
+     * Allow exactly @p n calls.
+     */
+    static constexpr Cardinality exactly (std::size_t n) {
+        return Cardinality{n, n};
+    }
+
+    /**
+     * Allow @p n or more calls.
+     */
+    static constexpr Cardinality at_least (std::size_t n) {
+        return Cardinality{n, unbounded};
+    }
+
+    /**
+     * Allow up to @p n calls, including none.
+     */
+    static constexpr Cardinality at_most (std::size_t n) {
+        return Cardinality{0, n};
+    }
+
+    /**
+     * Allow any number of calls from @p min to @p max, inclusive.
+     */
+    static constexpr Cardinality between (std::size_t min, std::size_t max) {
+        return Cardinality{min, max};
+    }
+
+    constexpr std::size_t min () const { return min_; }
+    constexpr std::size_t max () const { return max_; }
+
+    /**
+     * Indicates whether @p count calls are enough to satisfy this cardinality.
+     */
+    constexpr bool is_satisfied_by (std::size_t count) const {
+        return count >= min_;
+    }
+
+    /**
+     * Indicates whether no call can follow @p count calls without exceeding
+     * this cardinality.
+     */
+    constexpr bool is_saturated_by (std::size_t count) const {
+        return count >= max_;
+    }
+
+    /**
+     * Provides a human-oriented description, e.g. "at least 2 call(s)".
+     */
+    std::string describe () const {
+        if (min_ == max_) {
+            return "exactly " + std::to_string(min_) + " call(s)";
+        } else if (max_ == unbounded) {
+            return "at least " + std::to_string(min_) + " call(s)";
+        } else if (min_ == 0) {
+            return "at most " + std::to_string(max_) + " call(s)";
+        } else {
+            return "between " + std::to_string(min_) + " and " +
+                std::to_string(max_) + " call(s)";
+        }
+    }
+
+    friend constexpr bool operator == (Cardinality, Cardinality) = default;
+
+  private:
+    constexpr Cardinality (std::size_t min, std::size_t max)
+          : min_{min}, max_{max} {}
+
+    std::size_t min_;
+    std::size_t max_;
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__CARDINALITY_HPP_
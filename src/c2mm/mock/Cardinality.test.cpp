@@ -0,0 +1,41 @@
+#include "c2mm/mock/Cardinality.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE ("mock::Cardinality") {
+    using c2mm::mock::Cardinality;
+
+    SECTION ("exactly") {
+        constexpr auto card = Cardinality::exactly(2);
+        STATIC_CHECK(not card.is_satisfied_by(1));
+        STATIC_CHECK(card.is_satisfied_by(2));
+        STATIC_CHECK(not card.is_saturated_by(1));
+        STATIC_CHECK(card.is_saturated_by(2));
+        CHECK(card.describe() == "exactly 2 call(s)");
+    }
+
+    SECTION ("at_least") {
+        constexpr auto card = Cardinality::at_least(3);
+        STATIC_CHECK(not card.is_satisfied_by(2));
+        STATIC_CHECK(card.is_satisfied_by(3));
+        STATIC_CHECK(not card.is_saturated_by(1'000'000));
+        CHECK(card.describe() == "at least 3 call(s)");
+    }
+
+    SECTION ("at_most") {
+        constexpr auto card = Cardinality::at_most(1);
+        STATIC_CHECK(card.is_satisfied_by(0));
+        STATIC_CHECK(not card.is_saturated_by(0));
+        STATIC_CHECK(card.is_saturated_by(1));
+        CHECK(card.describe() == "at most 1 call(s)");
+    }
+
+    SECTION ("between") {
+        constexpr auto card = Cardinality::between(1, 4);
+        STATIC_CHECK(not card.is_satisfied_by(0));
+        STATIC_CHECK(card.is_satisfied_by(1));
+        STATIC_CHECK(not card.is_saturated_by(3));
+        STATIC_CHECK(card.is_saturated_by(4));
+        CHECK(card.describe() == "between 1 and 4 call(s)");
+    }
+}
@@ -0,0 +1,174 @@
+#ifndef C2MM__MOCK__DISPATCH_TABLE_HPP_
+#define C2MM__MOCK__DISPATCH_TABLE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace c2mm::mock {
+/**
+ * Maps values of an integral or enum type to buckets of values, for dispatch
+ * in constant time.
+ *
+ * While the keys are compact, the buckets are kept in a flat array indexed by
+ * the key's offset from the smallest key, so a lookup is a subtraction, a
+ * comparison and an index. Keys are compact while they span at most @p
+ * t_min_dense values or four times as many values as there are keys. Once the
+ * keys are too sparse, the buckets move to a hash table for good.
+ *
+ * @tparam T_Key The type of the keys. Must be integral or an enum.
+ * @tparam T_Value The type of the values in each bucket.
+ * @tparam t_min_dense Number of values the keys may span while dense,
+ *     however few keys there are.
+ */
+template <typename T_Key, typename T_Value, std::size_t t_min_dense = 256>
+class Dispatch_Table {
+    static_assert(std::is_integral_v<T_Key> or std::is_enum_v<T_Key>);
+
+  public:
+    using Bucket = std::pmr::vector<T_Value>;
+
+    /**
+     * Construct an empty table.
+     * @param[in] resource Memory resource from which the table and its
+     *     buckets are allocated. Must outlive this object.
+     */
+    explicit Dispatch_Table (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : dense_{resource},
+        present_(resource),
+        sparse_{resource} {}
+
+    /**
+     * Indicates whether a bucket was ever created.
+     */
+    bool empty () const { return num_keys_ == 0; }
+
+    /**
+     * Indicates whether the buckets are kept in a flat array.
+     */
+    bool is_dense () const { return dense_mode_; }
+
+    /**
+     * The bucket for @p key, created empty if there is none.
+     * @param[in] key The key of the bucket.
+     * @return Reference to the bucket. Invalidated by the next call.
+     */
+    Bucket& bucket (T_Key key) {
+        auto const ordinal = to_ordinal(key);
+
+        if (dense_mode_) {
+            if (dense_.empty()) {
+                grow_dense(ordinal, ordinal);
+            } else {
+                auto const low = std::min(base_, ordinal);
+                auto const high = std::max(
+                    base_ + (dense_.size() - 1),
+                    ordinal
+                );
+                if (fits_dense(low, high)) {
+                    grow_dense(low, high);
+                } else {
+                    make_sparse();
+                }
+            }
+        }
+
+        if (dense_mode_) {
+            auto const offset = static_cast<std::size_t>(ordinal - base_);
+            if (not present_[offset]) {
+                present_[offset] = true;
+                ++num_keys_;
+            }
+            return dense_[offset];
+        }
+
+        auto const [iter, inserted] = sparse_.try_emplace(ordinal);
+        if (inserted) {
+            ++num_keys_;
+        }
+        return iter->second;
+    }
+
+    /**
+     * Find the bucket for @p key.
+     * @param[in] key The key of the bucket.
+     * @return Pointer to the bucket or @c nullptr if there is none.
+     */
+    Bucket* find (T_Key key) {
+        auto const ordinal = to_ordinal(key);
+
+        if (dense_mode_) {
+            auto const offset = ordinal - base_;
+            return offset < dense_.size() ? &dense_[offset] : nullptr;
+        }
+
+        auto const iter = sparse_.find(ordinal);
+        return iter == sparse_.end() ? nullptr : &iter->second;
+    }
+
+  private:
+    // Maps keys to unsigned values in the same order.
+    static std::uint64_t to_ordinal (T_Key key) {
+        using Integer = typename std::conditional_t<
+            std::is_enum_v<T_Key>,
+            std::underlying_type<T_Key>,
+            std::type_identity<T_Key>
+        >::type;
+
+        auto const value = static_cast<Integer>(key);
+        if constexpr (std::is_signed_v<Integer>) {
+            return static_cast<std::uint64_t>(
+                static_cast<std::int64_t>(value)
+            ) ^ (std::uint64_t{1} << 63);
+        } else {
+            return static_cast<std::uint64_t>(value);
+        }
+    }
+
+    bool fits_dense (std::uint64_t low, std::uint64_t high) const {
+        return high - low < std::max<std::uint64_t>(
+            t_min_dense,
+            4 * (num_keys_ + 1)
+        );
+    }
+
+    void grow_dense (std::uint64_t low, std::uint64_t high) {
+        if (not dense_.empty() and low < base_) {
+            auto const shift = static_cast<std::size_t>(base_ - low);
+            dense_.insert(dense_.begin(), shift, Bucket{});
+            present_.insert(present_.begin(), shift, false);
+        }
+
+        auto const size = static_cast<std::size_t>(high - low) + 1;
+        dense_.resize(size);
+        present_.resize(size);
+        base_ = low;
+    }
+
+    void make_sparse () {
+        for (std::size_t offset = 0; offset < dense_.size(); ++offset) {
+            if (present_[offset]) {
+                sparse_.emplace(base_ + offset, std::move(dense_[offset]));
+            }
+        }
+        dense_.clear();
+        present_.clear();
+        dense_mode_ = false;
+    }
+
+    std::pmr::vector<Bucket> dense_;
+    std::pmr::vector<bool> present_;
+    std::pmr::unordered_map<std::uint64_t, Bucket> sparse_;
+    std::uint64_t base_ = 0;
+    std::size_t num_keys_ = 0;
+    bool dense_mode_ = true;
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__DISPATCH_TABLE_HPP_
@@ -0,0 +1,71 @@
+#include "c2mm/mock/Dispatch_Table.hpp"
+
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+enum class Msg : std::uint8_t { ping, pong, data, close };
+}  // namespace
+
+SCENARIO ("mock::Dispatch_Table maps integral and enum keys to buckets") {
+    using c2mm::mock::Dispatch_Table;
+
+    GIVEN ("a table keyed on an enum") {
+        Dispatch_Table<Msg, int> table{};
+
+        THEN ("it starts empty") {
+            CHECK(table.empty());
+            CHECK(table.find(Msg::ping) == nullptr);
+        }
+
+        WHEN ("buckets are filled for some values") {
+            table.bucket(Msg::data).push_back(1);
+            table.bucket(Msg::ping).push_back(2);
+            table.bucket(Msg::data).push_back(3);
+
+            THEN ("each value finds its bucket in a flat array") {
+                CHECK(table.is_dense());
+                CHECK(not table.empty());
+                REQUIRE(table.find(Msg::data) != nullptr);
+                CHECK(table.find(Msg::data)->size() == 2);
+                CHECK(table.find(Msg::data)->back() == 3);
+                REQUIRE(table.find(Msg::ping) != nullptr);
+                CHECK(table.find(Msg::ping)->size() == 1);
+                CHECK((table.find(Msg::pong) == nullptr or
+                    table.find(Msg::pong)->empty()));
+                CHECK(table.find(Msg::close) == nullptr);
+            }
+        }
+    }
+
+    GIVEN ("a table keyed on a signed integer") {
+        Dispatch_Table<int, int> table{};
+        for (int key = 10; key >= -10; --key) {
+            table.bucket(key).push_back(key);
+        }
+
+        THEN ("negative keys extend the flat array downwards") {
+            CHECK(table.is_dense());
+            for (int key = -10; key <= 10; ++key) {
+                REQUIRE(table.find(key) != nullptr);
+                CHECK(table.find(key)->front() == key);
+            }
+            CHECK(table.find(11) == nullptr);
+            CHECK(table.find(-11) == nullptr);
+        }
+
+        WHEN ("a key far from the others is added") {
+            table.bucket(1'000'000).push_back(7);
+
+            THEN ("the buckets move to a hash table") {
+                CHECK(not table.is_dense());
+                REQUIRE(table.find(1'000'000) != nullptr);
+                CHECK(table.find(1'000'000)->front() == 7);
+                REQUIRE(table.find(-10) != nullptr);
+                CHECK(table.find(-10)->front() == -10);
+                CHECK(table.find(11) == nullptr);
+            }
+        }
+    }
+}
@@ -2,12 +2,13 @@
 #define C2MM__MOCK__EXPECTATION_HPP_
 
 #include <cstddef>
-#include <memory>
+#include <memory_resource>
 #include <utility>
 
-#include <catch2/matchers/catch_matchers.hpp>
-
-#include "c2mm/mock/Default_Action.hpp"
+#include "c2mm/matchers/Inline_Matcher.hpp"
+#include "c2mm/matchers/Matcher_Base.hpp"
+#include "c2mm/mock/Cardinality.hpp"
+#include "c2mm/mock/Inline_Action.hpp"
 #include "c2mm/mock/args.hpp"
 
 namespace c2mm::mock {
@@ -22,28 +23,80 @@ class Expectation;
 /**
  * Wraps and controls access to a particular action a mock function can execute
  * in response to a call.
+ *
+ * The action is @c Default_Action until another is set. It is stored inline
+ * and receives the arguments of each call it handles.
+ *
+ * How many calls are handled is limited by a @c Cardinality, which is at most
+ * one call unless changed. Once the maximum is reached the expectation is
+ * saturated and consumes no more calls. The minimum is only checked when the
+ * owner asks, typically when the mock function is destroyed.
  */
 template <typename T_Return, typename... T_Parameters>
 class Expectation<T_Return(T_Parameters...)> {
   public:
+    using Return_Type = T_Return;
     using Args_Tuple = Bound_Args<T_Parameters...>;
-    using Matcher = Catch::Matchers::MatcherBase<Args_Tuple>;
+    using Matcher = matchers::Matcher_Base<Args_Tuple>;
+    using Matcher_Storage = matchers::Inline_Matcher<Args_Tuple>;
+    using Action = Inline_Action<T_Return(T_Parameters...)>;
 
     /**
      * Construct from required components.
      *
      * @param[in] matcher Tuple matcher indicating whether this expectation can
-     *     accept a call based on it's arguments.
+     *     accept a call based on it's arguments. Either a concrete matcher,
+     *     which is stored inline, or a @c std::unique_ptr to a @c Matcher.
+     * @param[in] resource Memory resource from which an action too large to
+     *     store inline is allocated. Must outlive this object.
      */
-    Expectation (std::unique_ptr<Matcher> matcher)
-          : matcher_{std::move(matcher)} {}
+    Expectation (
+        Matcher_Storage matcher,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : matcher_{std::move(matcher)},
+        action_{resource} {}
 
     /**
      * Read-only accessor to the internal matcher.
      * @return Constant reference to the @c matcher field.
      */
     Matcher const& matcher () const {
-        return *matcher_;
+        return matcher_.base();
+    }
+
+    /**
+     * The number of calls this handles.
+     */
+    Cardinality const& cardinality () const { return cardinality_; }
+
+    /**
+     * Change the number of calls this handles.
+     */
+    void set_cardinality (Cardinality cardinality) {
+        cardinality_ = cardinality;
+    }
+
+    /**
+     * Number of calls handled so far.
+     */
+    std::size_t call_count () const { return call_count_; }
+
+    /**
+     * Indicates whether this expectation has handled as many calls as it can.
+     * A saturated expectation never consumes another call.
+     *
+     * @return @c true if this expectation has handled the maximum number of
+     *     calls of its cardinality.
+     */
+    bool is_saturated () const {
+        return cardinality_.is_saturated_by(call_count_);
+    }
+
+    /**
+     * Indicates whether enough calls were handled to satisfy the cardinality.
+     */
+    bool is_satisfied () const {
+        return cardinality_.is_satisfied_by(call_count_);
     }
 
     /**
@@ -52,41 +105,66 @@ class Expectation<T_Return(T_Parameters...)> {
      *
      * @param[in] args Tuple of references to the arguments of the call.
      *
-     * @return @c true if this expectation has not yet handled any calls and if
-     *     the matcher specified at construction matches @p args.
+     * @return @c true if this expectation is not saturated and if the matcher
+     *     specified at construction matches @p args.
      */
     bool can_consume (Args_Tuple const& args) const {
-        // TODO: retirement
-
-        // TODO: more complex cardinalities
-        if (call_count_ > 0) {
+        if (is_saturated()) {
             return false;
         }
 
         // TODO: cross-argument matcher
-        return matcher_->match(args);
+        return matcher_.match(args);
     }
 
     /**
-     * Handle the call by delegating to the default action.
+     * Replace the action which handles calls.
      *
-     * @todo Handle the call by delegating to the action specified at
-     *     construction.
+     * @param[in] action Callable invocable with the arguments of a call,
+     *     forwarded as @c T_Parameters&&..., whose result converts to @c
+     *     T_Return.
+     */
+    template <typename T_Action>
+    void set_action (T_Action&& action) {
+        action_.emplace(std::forward<T_Action>(action));
+    }
+
+    /**
+     * Count a call this consumes, without handling it yet. See @c run_action.
+     */
+    void record_call () { ++call_count_; }
+
+    /**
+     * Handle a call already counted by @c record_call by delegating to the
+     * action. Unlike @c record_call, this need not be synchronized with other
+     * calls, though the action may need to be.
      *
      * @param[in] args... Arguments of the call being handled, forwarded to the
-     *     internal action.
+     *     action.
      *
      * @return The result of the action.
      */
-    T_Return handle_call (T_Parameters&&... /* args */) {
-        ++call_count_;
+    T_Return run_action (T_Parameters&&... args) {
+        return action_(std::forward<T_Parameters>(args)...);
+    }
 
-        // TODO: execute custom action
-        return Default_Action<T_Return>{}();
+    /**
+     * Handle the call by delegating to the action.
+     *
+     * @param[in] args... Arguments of the call being handled, forwarded to the
+     *     action.
+     *
+     * @return The result of the action.
+     */
+    T_Return handle_call (T_Parameters&&... args) {
+        record_call();
+        return run_action(std::forward<T_Parameters>(args)...);
     }
 
   private:
-    std::unique_ptr<Matcher> matcher_;
+    Matcher_Storage matcher_;
+    Action action_;
+    Cardinality cardinality_ = Cardinality::at_most(1);
 
     std::size_t call_count_ = 0;
 };
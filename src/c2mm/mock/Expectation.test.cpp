@@ -1,16 +1,34 @@
 #include "c2mm/mock/Expectation.hpp"
 
 #include <memory>
+#include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
 
 #include "c2mm/matchers/Tuple_Matcher.hpp"
 #include "c2mm/matchers/Typed_Wrapper.hpp"
+#include "c2mm/mock/Cardinality.hpp"
 #include "c2mm/mock/args.hpp"
 #include "c2mm/mp/utils.hpp"
 
+namespace {
+// A matcher written against Catch2 alone.
+class First_Is_Three final
+      : public Catch::Matchers::MatcherBase<c2mm::mock::Bound_Args<int, int>> {
+  public:
+    bool match (c2mm::mock::Bound_Args<int, int> const& args) const override {
+        return std::get<0>(args) == 3;
+    }
+
+  protected:
+    std::string describe () const override { return "first is 3"; }
+};
+}  // namespace
+
 SCENARIO ("Class c2mm::mock::Expectation controls access to an action.") {
     using c2mm::mock::bind_args;
     using c2mm::mock::capture_args;
@@ -49,5 +67,60 @@ SCENARIO ("Class c2mm::mock::Expectation controls access to an action.") {
                 CHECK(not expectation.can_consume(bind_args(3, 4)));
             }
         }
+
+        THEN ("it needs no calls to be satisfied") {
+            CHECK(expectation.is_satisfied());
+        }
+
+        WHEN ("it expects exactly two calls") {
+            expectation.set_cardinality(
+                c2mm::mock::Cardinality::exactly(2)
+            );
+            expectation.handle_call(3, 4);
+
+            THEN ("it is neither saturated nor satisfied by one call") {
+                CHECK(expectation.call_count() == 1);
+                CHECK(not expectation.is_saturated());
+                CHECK(not expectation.is_satisfied());
+                CHECK(expectation.can_consume(bind_args(3, 4)));
+            }
+
+            AND_WHEN ("a second call is handled") {
+                expectation.handle_call(3, 4);
+
+                THEN ("it is saturated and satisfied") {
+                    CHECK(expectation.is_saturated());
+                    CHECK(expectation.is_satisfied());
+                    CHECK(not expectation.can_consume(bind_args(3, 4)));
+                }
+            }
+        }
+
+        WHEN ("an action is set and a call is handled") {
+            expectation.set_action([] (int lhs, int rhs) {
+                return lhs * rhs;
+            });
+            auto result = expectation.handle_call(3, 4);
+
+            THEN ("the action is executed with the arguments") {
+                CHECK(result == 12);
+            }
+        }
+    }
+
+    GIVEN ("an Expectation built from a Catch2 matcher") {
+        using Expectation = c2mm::mock::Expectation<int(int, int)>;
+        STATIC_CHECK(std::is_same_v<
+            Expectation::Matcher,
+            Catch::Matchers::MatcherBase<Expectation::Args_Tuple>
+        >);
+
+        Expectation expectation{std::make_unique<First_Is_Three>()};
+
+        THEN ("it consumes the calls the matcher matches") {
+            CHECK(expectation.can_consume(bind_args(3, 9)));
+            CHECK(not expectation.can_consume(bind_args(4, 3)));
+            CHECK(expectation.matcher().toString() == "first is 3");
+        }
     }
 }
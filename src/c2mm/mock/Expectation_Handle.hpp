@@ -1,7 +1,13 @@
 #ifndef C2MM__MOCK__EXPECTATION_HANDLE_HPP_
 #define C2MM__MOCK__EXPECTATION_HANDLE_HPP_
 
+#include <cstddef>
 #include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/mock/Cardinality.hpp"
+#include "c2mm/mock/actions.hpp"
 
 namespace c2mm::mock {
 /**
@@ -19,6 +25,94 @@ class Expectation_Handle {
     Expectation_Handle (T_Expectation& expectation)
           : expectation_{expectation} {}
 
+    /**
+     * Expect exactly @p n matching calls.
+     * @return This handle, for chaining.
+     */
+    Expectation_Handle& times (std::size_t n) {
+        expectation_.get().set_cardinality(Cardinality::exactly(n));
+        return *this;
+    }
+
+    /**
+     * Expect @p n or more matching calls.
+     * @return This handle, for chaining.
+     */
+    Expectation_Handle& at_least (std::size_t n) {
+        expectation_.get().set_cardinality(Cardinality::at_least(n));
+        return *this;
+    }
+
+    /**
+     * Expect up to @p n matching calls, including none.
+     * @return This handle, for chaining.
+     */
+    Expectation_Handle& at_most (std::size_t n) {
+        expectation_.get().set_cardinality(Cardinality::at_most(n));
+        return *this;
+    }
+
+    /**
+     * Handle matching calls by invoking @p action with their arguments.
+     *
+     * The action is stored inline in the expectation unless it is large. The
+     * arguments of each call are forwarded to it as they were passed to the
+     * mock. Actions run without the mock's lock held, so they may call the
+     * same mock. Calls to a multi-threaded mock may run the same action
+     * concurrently, so an action which keeps state must synchronize it, as
+     * those set by @c returns_in_sequence do.
+     *
+     * @param[in] action Callable invocable with the arguments of a call whose
+     *     result converts to the return type of the mocked function.
+     * @return This handle, for chaining.
+     */
+    template <typename T_Action>
+    Expectation_Handle& execute (T_Action&& action) {
+        expectation_.get().set_action(std::forward<T_Action>(action));
+        return *this;
+    }
+
+    /**
+     * Return a copy of @p value from each matching call.
+     * @return This handle, for chaining.
+     */
+    template <typename T_Value>
+    Expectation_Handle& returns (T_Value&& value) {
+        return execute(actions::Return<std::decay_t<T_Value>>{
+            std::forward<T_Value>(value)
+        });
+    }
+
+    /**
+     * Return @p first from the first matching call, then each of @p rest in
+     * turn from those after it. The last value is returned from every call
+     * once all have been returned.
+     * @return This handle, for chaining.
+     */
+    template <typename T_Value, typename... T_Values>
+    Expectation_Handle& returns_in_sequence (
+        T_Value&& first,
+        T_Values&&... rest
+    ) {
+        using Value = std::decay_t<T_Value>;
+        return execute(actions::Return_Sequence<Value>{{
+            Value(std::forward<T_Value>(first)),
+            Value(std::forward<T_Values>(rest))...,
+        }});
+    }
+
+    /**
+     * Throw a copy of @p exception from each matching call.
+     * @return This handle, for chaining.
+     */
+    template <typename T_Exception>
+    Expectation_Handle& throws (T_Exception&& exception) {
+        return execute(actions::Throw<
+            typename T_Expectation::Return_Type,
+            std::decay_t<T_Exception>
+        >{std::forward<T_Exception>(exception)});
+    }
+
   private:
     std::reference_wrapper<T_Expectation> expectation_;
 };
@@ -0,0 +1,355 @@
+#ifndef C2MM__MOCK__EXPECTATION_SET_HPP_
+#define C2MM__MOCK__EXPECTATION_SET_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "c2mm/matchers/Tuple_Matcher.hpp"
+#include "c2mm/matchers/Typed_Wrapper.hpp"
+#include "c2mm/mock/Arg_Hasher.hpp"
+#include "c2mm/mock/Dispatch_Table.hpp"
+#include "c2mm/mock/Expectation.hpp"
+#include "c2mm/mock/args.hpp"
+#include "c2mm/mock/storage/Chunked.hpp"
+
+namespace c2mm::mock {
+/**
+ * Primary template for @c Expectation_Set is intentionally not defined.
+ *
+ * See specializations for full documentation.
+ */
+template <
+    typename T_Signature,
+    typename T_Expectation = Expectation<T_Signature>
+>
+class Expectation_Set;
+
+/**
+ * The expectations of a mock function, in the order they were added.
+ *
+ * Finding the expectation which should handle a call is the hot path of every
+ * mock function call, so this keeps three structures beside the expectations
+ * themselves:
+ *  - Expectations whose every constraint is an exact value (a plain value or
+ *    @c equal_to) of a hashable type are indexed by the hash of those values,
+ *    so only expectations with a matching hash are checked.
+ *  - Other expectations whose constraint on the first integral or enum
+ *    parameter is an exact value are kept in a @c Dispatch_Table keyed on
+ *    that value, so only expectations for the argument's value are checked.
+ *    For example, expectations on a message type which match any payload.
+ *  - All other expectations are kept in a list which is scanned in order.
+ *
+ * Saturated expectations are removed from each the first time they are
+ * encountered so they cost nothing on later calls.
+ *
+ * Expectations and their matchers are stored inline in chunks, so adding an
+ * expectation only allocates once per chunk. Expectations never move once
+ * added. The chunks, the indexes and any matcher too large to store inline
+ * are allocated from the memory resource given at construction.
+ *
+ * @tparam T_Expectation The type of expectation to store, e.g. @c Expectation
+ *     or @c Call_Expectation. Must be constructible from a matcher of @c
+ *     Args_Tuple and provide @c is_saturated and @c can_consume.
+ */
+template <
+    typename T_Return,
+    typename... T_Parameters,
+    typename T_Expectation
+>
+class Expectation_Set<T_Return(T_Parameters...), T_Expectation> {
+  public:
+    using Expectation_Type = T_Expectation;
+    using Args_Tuple = typename Expectation_Type::Args_Tuple;
+
+    /**
+     * Construct an empty set.
+     * @param[in] resource Memory resource from which expectations are
+     *     allocated. Must outlive this object.
+     */
+    explicit Expectation_Set (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : entries_{resource},
+        index_{resource},
+        keyed_{resource} {}
+
+    Expectation_Set (Expectation_Set const&) = delete;
+    Expectation_Set& operator = (Expectation_Set const&) = delete;
+
+    /**
+     * Indicates whether an expectation was ever added. This only changes when
+     * expectations are added so it is safe to read while calls are being
+     * dispatched.
+     */
+    bool empty () const { return entries_.empty(); }
+
+    /**
+     * Create an @c Expectation for calls that match @p arg_constraints. It has
+     * lower priority than every expectation already in the set.
+     *
+     * @param[in] arg_constraints... Constraints on individual arguments.
+     *
+     * @return A reference to the new expectation.
+     */
+    template <typename... T_Constraints>
+    Expectation_Type& add (T_Constraints&&... arg_constraints) {
+        using c2mm::matchers::Evaluation_Order;
+        using c2mm::matchers::matches;
+        using c2mm::matchers::wrap_for;
+
+        std::optional<std::size_t> const key = constraint_key(
+            arg_constraints...
+        );
+        std::optional<Dispatch_Key> const dispatch_key = key
+            ? std::nullopt
+            : dispatch_key_of(arg_constraints...);
+
+        typename Expectation_Type::Matcher_Storage matcher{
+            std::allocator_arg,
+            resource(),
+            wrap_for<Args_Tuple>(
+                matches<Evaluation_Order::cheapest_first>(
+                    capture_args(
+                        std::forward<T_Constraints>(arg_constraints)...
+                    )
+                )
+            ),
+        };
+
+        // Expectations with an action allocate it from the same resource.
+        Entry& entry = [&] () -> Entry& {
+            if constexpr (std::is_constructible_v<
+                Expectation_Type,
+                typename Expectation_Type::Matcher_Storage,
+                std::pmr::memory_resource*
+            >) {
+                return entries_.emplace(
+                    entries_.size(),
+                    std::move(matcher),
+                    resource()
+                );
+            } else {
+                return entries_.emplace(entries_.size(), std::move(matcher));
+            }
+        }();
+
+        if (key) {
+            index_[*key].push_back(&entry);
+        } else if (dispatch_key) {
+            if constexpr (has_dispatch_param) {
+                keyed_.bucket(*dispatch_key).push_back(&entry);
+            }
+        } else {
+            link(entry);
+        }
+
+        return entry.expectation;
+    }
+
+    /**
+     * Find the first expectation, in the order they were added, which can
+     * consume the call identified by @p args.
+     *
+     * Only saturated expectations are removed, so for expectations which
+     * never saturate this doesn't modify the set and may run concurrently.
+     *
+     * @param[in] args Tuple of references to the arguments of the call.
+     *
+     * @return A pointer to the expectation or @c nullptr if there is none.
+     */
+    Expectation_Type* find (Args_Tuple const& args) {
+        Entry* found = nullptr;
+
+        if constexpr (Hasher::can_hash_args) {
+            if (not index_.empty()) {
+                found = find_indexed(args);
+            }
+        }
+
+        if constexpr (has_dispatch_param) {
+            if (not keyed_.empty()) {
+                Entry* keyed = find_keyed(args);
+                if (keyed and
+                    (not found or keyed->sequence < found->sequence)
+                ) {
+                    found = keyed;
+                }
+            }
+        }
+
+        Entry* entry = scan_head_;
+        while (entry and (not found or entry->sequence < found->sequence)) {
+            Entry* next = entry->next;
+            if (entry->expectation.is_saturated()) {
+                unlink(*entry);
+            } else if (entry->expectation.can_consume(args)) {
+                found = entry;
+                break;
+            }
+            entry = next;
+        }
+
+        return found ? &found->expectation : nullptr;
+    }
+
+    /**
+     * Call @p func with every expectation ever added, in the order they were
+     * added, including saturated ones.
+     * @param[in] func Unary function accepting `Expectation_Type const&`.
+     */
+    template <typename T_Func>
+    void for_each (T_Func&& func) const {
+        for (Entry const& entry : entries_) {
+            func(entry.expectation);
+        }
+    }
+
+  private:
+    struct Entry {
+        template <typename... T_Args>
+        explicit Entry (std::size_t seq, T_Args&&... args)
+              : expectation{std::forward<T_Args>(args)...},
+                sequence{seq} {}
+
+        Expectation_Type expectation;
+        std::size_t sequence;
+        Entry* prev = nullptr;
+        Entry* next = nullptr;
+    };
+
+    using Hasher = Arg_Hasher<T_Parameters...>;
+    using Bucket = std::pmr::vector<Entry*>;
+
+    // The first integral or enum parameter, which keys the dispatch table.
+    static constexpr std::size_t dispatch_param = [] {
+        constexpr bool is_key[] = {
+            (std::is_integral_v<std::remove_cvref_t<T_Parameters>> or
+                std::is_enum_v<std::remove_cvref_t<T_Parameters>>)...,
+            false,
+        };
+        std::size_t idx = 0;
+        while (idx < sizeof...(T_Parameters) and not is_key[idx]) {
+            ++idx;
+        }
+        return idx;
+    }();
+    static constexpr bool has_dispatch_param =
+        dispatch_param < sizeof...(T_Parameters);
+
+    // An unused placeholder when there is no such parameter.
+    using Dispatch_Key = std::tuple_element_t<
+        dispatch_param,
+        std::tuple<std::remove_cvref_t<T_Parameters>..., int>
+    >;
+
+    std::pmr::memory_resource* resource () const {
+        return index_.get_allocator().resource();
+    }
+
+    template <typename... T_Constraints>
+    static std::optional<std::size_t> constraint_key (
+        T_Constraints const&... constraints
+    ) {
+        if constexpr (
+            Hasher::template can_hash_constraints<T_Constraints...>()
+        ) {
+            return Hasher::hash_constraints(constraints...);
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    template <typename... T_Constraints>
+    static std::optional<Dispatch_Key> dispatch_key_of (
+        T_Constraints const&... constraints
+    ) {
+        if constexpr (
+            has_dispatch_param and
+            sizeof...(T_Constraints) == sizeof...(T_Parameters)
+        ) {
+            using Constraint = std::remove_cvref_t<std::tuple_element_t<
+                dispatch_param,
+                std::tuple<T_Constraints...>
+            >>;
+
+            if constexpr (
+                impl_::is_exact_indexable<Dispatch_Key, Constraint>()
+            ) {
+                return static_cast<Dispatch_Key>(
+                    impl_::Exact_Value<Constraint>::get(
+                        std::get<dispatch_param>(std::tie(constraints...))
+                    )
+                );
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Find the first expectation in `bucket` which can consume the call,
+    // dropping saturated expectations along the way.
+    static Entry* find_in_bucket (Bucket& bucket, Args_Tuple const& args) {
+        Entry* found = nullptr;
+        std::erase_if(bucket, [&] (Entry* entry) {
+            if (entry->expectation.is_saturated()) {
+                return true;
+            }
+            if (not found and entry->expectation.can_consume(args)) {
+                found = entry;
+            }
+            return false;
+        });
+        return found;
+    }
+
+    Entry* find_indexed (Args_Tuple const& args) {
+        auto bucket_iter = index_.find(Hasher::hash_args(args));
+        if (bucket_iter == index_.end()) {
+            return nullptr;
+        }
+
+        auto& bucket = bucket_iter->second;
+        Entry* found = find_in_bucket(bucket, args);
+
+        if (bucket.empty()) {
+            index_.erase(bucket_iter);
+        }
+        return found;
+    }
+
+    Entry* find_keyed (Args_Tuple const& args) {
+        Bucket* bucket = keyed_.find(std::get<dispatch_param>(args));
+        return bucket ? find_in_bucket(*bucket, args) : nullptr;
+    }
+
+    void link (Entry& entry) {
+        entry.prev = scan_tail_;
+        if (scan_tail_) {
+            scan_tail_->next = &entry;
+        } else {
+            scan_head_ = &entry;
+        }
+        scan_tail_ = &entry;
+    }
+
+    void unlink (Entry& entry) {
+        (entry.prev ? entry.prev->next : scan_head_) = entry.next;
+        (entry.next ? entry.next->prev : scan_tail_) = entry.prev;
+        entry.prev = nullptr;
+        entry.next = nullptr;
+    }
+
+    storage::Chunked_List<Entry> entries_;
+    std::pmr::unordered_map<std::size_t, Bucket> index_;
+    Dispatch_Table<Dispatch_Key, Entry*> keyed_;
+    Entry* scan_head_ = nullptr;
+    Entry* scan_tail_ = nullptr;
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__EXPECTATION_SET_HPP_
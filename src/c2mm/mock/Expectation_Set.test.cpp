@@ -0,0 +1,118 @@
+#include "c2mm/mock/Expectation_Set.hpp"
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/mock/args.hpp"
+
+SCENARIO ("c2mm::mock::Expectation_Set finds the first matching expectation") {
+    using c2mm::matchers::equal_to;
+    using c2mm::matchers::greater_than;
+    using c2mm::mock::bind_args;
+    using Expectation_Set = c2mm::mock::Expectation_Set<int(int, std::string)>;
+
+    GIVEN ("an empty Expectation_Set") {
+        Expectation_Set set{};
+
+        THEN ("it finds nothing") {
+            CHECK(set.empty());
+            CHECK(set.find(bind_args(1, std::string{"a"})) == nullptr);
+        }
+    }
+
+    GIVEN ("a mix of exact-value and general expectations") {
+        Expectation_Set set{};
+        auto& exact = set.add(1, std::string{"one"});
+        auto& general = set.add(greater_than(0), equal_to(std::string{"two"}));
+        auto& also_exact = set.add(equal_to(2), std::string{"two"});
+
+        THEN ("exact-value expectations are found by value") {
+            CHECK(set.find(bind_args(1, std::string{"one"})) == &exact);
+            CHECK(set.find(bind_args(1, std::string{"two"})) == &general);
+            CHECK(set.find(bind_args(1, std::string{"three"})) == nullptr);
+            CHECK(set.find(bind_args(-1, std::string{"one"})) == nullptr);
+        }
+
+        THEN ("earlier expectations take priority") {
+            CHECK(set.find(bind_args(2, std::string{"two"})) == &general);
+        }
+
+        WHEN ("expectations are saturated") {
+            (void)general.handle_call(1, "two");
+            (void)exact.handle_call(1, "one");
+
+            THEN ("they are skipped") {
+                CHECK(set.find(bind_args(1, std::string{"one"})) == nullptr);
+                CHECK(set.find(bind_args(2, std::string{"two"})) == &also_exact);
+            }
+
+            AND_WHEN ("every expectation is saturated") {
+                (void)also_exact.handle_call(2, "two");
+
+                THEN ("nothing is found") {
+                    CHECK(set.find(bind_args(2, std::string{"two"})) == nullptr);
+                    CHECK(set.find(bind_args(1, std::string{"one"})) == nullptr);
+                    CHECK(not set.empty());
+                }
+            }
+        }
+    }
+
+    GIVEN ("many exact-value expectations") {
+        Expectation_Set set{};
+        for (int i = 0; i < 1000; ++i) {
+            set.add(i, std::to_string(i));
+        }
+
+        THEN ("each is found by value") {
+            auto* found = set.find(bind_args(617, std::string{"617"}));
+            REQUIRE(found != nullptr);
+            CHECK(found->can_consume(bind_args(617, std::string{"617"})));
+            CHECK(not found->can_consume(bind_args(616, std::string{"616"})));
+        }
+    }
+}
+
+namespace {
+enum class Msg { ping, pong, data };
+}  // namespace
+
+SCENARIO ("c2mm::mock::Expectation_Set dispatches on an enum argument") {
+    using c2mm::matchers::greater_than;
+    using c2mm::matchers::less_than;
+    using c2mm::mock::bind_args;
+    using Expectation_Set = c2mm::mock::Expectation_Set<
+        void(Msg, std::string)
+    >;
+
+    GIVEN ("expectations on exact messages with any payload") {
+        Expectation_Set set{};
+        auto& early = set.add(less_than(Msg::pong), std::string{"x"});
+        auto& ping = set.add(Msg::ping, greater_than(std::string{}));
+        auto& data = set.add(Msg::data, greater_than(std::string{}));
+        auto& data_late = set.add(Msg::data, greater_than(std::string{"m"}));
+
+        THEN ("calls find the expectation for their message") {
+            CHECK(set.find(bind_args(Msg::ping, std::string{"y"})) == &ping);
+            CHECK(set.find(bind_args(Msg::data, std::string{"y"})) == &data);
+            CHECK(set.find(bind_args(Msg::pong, std::string{"y"})) == nullptr);
+            CHECK(set.find(bind_args(Msg::data, std::string{})) == nullptr);
+        }
+
+        THEN ("earlier expectations take priority") {
+            CHECK(set.find(bind_args(Msg::ping, std::string{"x"})) == &early);
+        }
+
+        WHEN ("an expectation is saturated") {
+            set.find(bind_args(Msg::data, std::string{"z"}))
+                ->handle_call(Msg::data, "z");
+
+            THEN ("the next one for the message is found") {
+                CHECK(set.find(bind_args(Msg::data, std::string{"z"}))
+                    == &data_late);
+            }
+        }
+    }
+}
@@ -0,0 +1,195 @@
+#ifndef C2MM__MOCK__INLINE_ACTION_HPP_
+#define C2MM__MOCK__INLINE_ACTION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/mock/Default_Action.hpp"
+
+namespace c2mm::mock {
+/**
+ * Primary template for @c Inline_Action is intentionally not defined.
+ *
+ * See specializations for full documentation.
+ */
+template <typename T_Signature, std::size_t t_capacity = 64>
+class Inline_Action;
+
+/**
+ * Owns the action of an expectation, a callable of any concrete type, without
+ * allocating.
+ *
+ * Any callable which is invocable with the arguments of a call, forwarded as
+ * @c T_Parameters&&..., and whose result converts to @p T_Return can be
+ * stored. If it fits in @p t_capacity bytes it is stored inline. Otherwise it
+ * falls back to an allocation from the memory resource given at
+ * construction. Until another action is stored, the action is @c
+ * Default_Action.
+ *
+ * As with @c matchers::Inline_Matcher, the concrete type is erased with a
+ * table of function pointers, so calling the action is a single indirect call
+ * into code where the callable is inlined.
+ *
+ * @tparam T_Return The return type of the action.
+ * @tparam T_Parameters Types of the parameters of the mocked function.
+ * @tparam t_capacity Size of the inline buffer in bytes.
+ */
+template <typename T_Return, typename... T_Parameters, std::size_t t_capacity>
+class Inline_Action<T_Return(T_Parameters...), t_capacity> {
+  public:
+    /**
+     * Store @c Default_Action.
+     * @param[in] resource Memory resource for the fallback allocation of
+     *     actions stored later. Must outlive this object.
+     */
+    explicit Inline_Action (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : resource_{resource} {
+        construct(Default_Action<T_Return>{});
+    }
+
+    Inline_Action (Inline_Action&& other)
+          : vtable_{other.vtable_},
+            resource_{other.resource_} {
+        vtable_->relocate(storage_, other.storage_);
+        other.vtable_ = nullptr;
+    }
+
+    Inline_Action (Inline_Action const&) = delete;
+    Inline_Action& operator = (Inline_Action const&) = delete;
+    Inline_Action& operator = (Inline_Action&&) = delete;
+
+    ~Inline_Action () { reset(); }
+
+    /**
+     * Replace the stored action with @p action.
+     * @param[in] action The callable to store.
+     */
+    template <typename T_Action>
+        requires std::is_invocable_r_v<
+            T_Return,
+            std::decay_t<T_Action>&,
+            T_Parameters&&...
+        >
+    void emplace (T_Action&& action) {
+        reset();
+        try {
+            construct(std::forward<T_Action>(action));
+        } catch (...) {
+            construct(Default_Action<T_Return>{});
+            throw;
+        }
+    }
+
+    /**
+     * Invoke the stored action.
+     * @param[in] args... Arguments of the call, forwarded to the action.
+     * @return The result of the action.
+     */
+    T_Return operator () (T_Parameters&&... args) {
+        return vtable_->invoke(storage_, std::forward<T_Parameters>(args)...);
+    }
+
+  private:
+    struct VTable {
+        T_Return (*invoke)(void*, T_Parameters&&...);
+        void (*relocate)(void*, void*);
+        void (*destroy)(void*, std::pmr::memory_resource*);
+    };
+
+    template <typename T_Action>
+    static constexpr bool fits_inline =
+        sizeof(T_Action) <= t_capacity and
+        alignof(T_Action) <= alignof(std::max_align_t) and
+        std::is_nothrow_move_constructible_v<T_Action>;
+
+    template <typename T_Action>
+    static T_Action& get_inline (void* storage) {
+        return *std::launder(static_cast<T_Action*>(storage));
+    }
+
+    template <typename T_Action>
+    static T_Action* get_allocated (void* storage) {
+        return *std::launder(static_cast<T_Action**>(storage));
+    }
+
+    // Like `std::invoke_r`, discarding the result for `void` actions.
+    template <typename T_Action>
+    static T_Return call (T_Action& action, T_Parameters&&... args) {
+        if constexpr (std::is_void_v<T_Return>) {
+            std::invoke(action, std::forward<T_Parameters>(args)...);
+        } else {
+            return std::invoke(action, std::forward<T_Parameters>(args)...);
+        }
+    }
+
+    template <typename T_Action>
+    void construct (T_Action&& action) {
+        using Action = std::decay_t<T_Action>;
+
+        if constexpr (fits_inline<Action>) {
+            ::new (static_cast<void*>(storage_))
+                Action(std::forward<T_Action>(action));
+            vtable_ = &inline_vtable<Action>;
+        } else {
+            std::pmr::polymorphic_allocator<> allocator{resource_};
+            ::new (static_cast<void*>(storage_)) Action*(
+                allocator.new_object<Action>(std::forward<T_Action>(action))
+            );
+            vtable_ = &allocated_vtable<Action>;
+        }
+    }
+
+    void reset () {
+        if (vtable_) {
+            vtable_->destroy(storage_, resource_);
+            vtable_ = nullptr;
+        }
+    }
+
+    template <typename T_Action>
+    static constexpr VTable inline_vtable{
+        [] (void* storage, T_Parameters&&... args) -> T_Return {
+            return call(
+                get_inline<T_Action>(storage),
+                std::forward<T_Parameters>(args)...
+            );
+        },
+        [] (void* dst, void* src) {
+            auto& source = get_inline<T_Action>(src);
+            ::new (dst) T_Action(std::move(source));
+            source.~T_Action();
+        },
+        [] (void* storage, std::pmr::memory_resource*) {
+            get_inline<T_Action>(storage).~T_Action();
+        },
+    };
+
+    template <typename T_Action>
+    static constexpr VTable allocated_vtable{
+        [] (void* storage, T_Parameters&&... args) -> T_Return {
+            return call(
+                *get_allocated<T_Action>(storage),
+                std::forward<T_Parameters>(args)...
+            );
+        },
+        [] (void* dst, void* src) {
+            ::new (dst) T_Action*(get_allocated<T_Action>(src));
+        },
+        [] (void* storage, std::pmr::memory_resource* resource) {
+            std::pmr::polymorphic_allocator<>{resource}
+                .delete_object(get_allocated<T_Action>(storage));
+        },
+    };
+
+    alignas(std::max_align_t) std::byte storage_[t_capacity];
+    VTable const* vtable_ = nullptr;
+    std::pmr::memory_resource* resource_;
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__INLINE_ACTION_HPP_
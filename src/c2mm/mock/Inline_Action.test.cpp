@@ -0,0 +1,139 @@
+#include "c2mm/mock/Inline_Action.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+int subtract (int lhs, int rhs) { return lhs - rhs; }
+}  // namespace
+
+SCENARIO ("mock::Inline_Action stores the action of an expectation") {
+    using c2mm::mock::Inline_Action;
+
+    alignas(std::max_align_t) std::byte buffer[1024];
+    std::pmr::monotonic_buffer_resource arena{
+        buffer,
+        sizeof(buffer),
+        std::pmr::null_memory_resource()
+    };
+
+    GIVEN ("a new Inline_Action") {
+        Inline_Action<std::string(int)> action{
+            std::pmr::null_memory_resource()
+        };
+
+        THEN ("it executes the default action") {
+            CHECK(action(3) == "");
+        }
+
+        WHEN ("a small callable is stored") {
+            action.emplace([prefix = std::string{"n="}] (int n) {
+                return prefix + std::to_string(n);
+            });
+
+            THEN ("it is called inline with the arguments") {
+                CHECK(action(3) == "n=3");
+            }
+
+            AND_WHEN ("the action is moved") {
+                Inline_Action<std::string(int)> moved{std::move(action)};
+
+                THEN ("the new object calls the same callable") {
+                    CHECK(moved(4) == "n=4");
+                }
+            }
+        }
+    }
+
+    GIVEN ("an Inline_Action storing a function") {
+        Inline_Action<int(int, int)> action{
+            std::pmr::null_memory_resource()
+        };
+        action.emplace(subtract);
+
+        THEN ("the function is called") {
+            CHECK(action(5, 3) == 2);
+        }
+    }
+
+    GIVEN ("an Inline_Action with a move-only parameter") {
+        Inline_Action<int(std::unique_ptr<int>)> action{};
+        std::unique_ptr<int> kept{};
+        action.emplace([&kept] (std::unique_ptr<int> value) {
+            kept = std::move(value);
+            return *kept;
+        });
+
+        THEN ("arguments are forwarded to the action") {
+            CHECK(action(std::make_unique<int>(9)) == 9);
+            REQUIRE(kept != nullptr);
+            CHECK(*kept == 9);
+        }
+    }
+
+    GIVEN ("a callable too large to fit inline and a memory resource") {
+        Inline_Action<int(std::size_t), 16> action{&arena};
+        std::array<int, 8> const values{1, 2, 3, 4, 5, 6, 7, 8};
+        action.emplace([values] (std::size_t idx) { return values[idx]; });
+
+        THEN ("it is allocated from the resource and still called") {
+            CHECK(action(5) == 6);
+        }
+    }
+
+    GIVEN ("a callable too large to fit inline and no memory") {
+        Inline_Action<int(std::size_t), 16> action{
+            std::pmr::null_memory_resource()
+        };
+        std::array<int, 8> const values{1, 2, 3, 4, 5, 6, 7, 8};
+
+        THEN ("storing it fails and the default action is kept") {
+            CHECK_THROWS_AS(
+                action.emplace([values] (std::size_t idx) {
+                    return values[idx];
+                }),
+                std::bad_alloc
+            );
+            CHECK(action(5) == 0);
+        }
+    }
+
+    GIVEN ("an Inline_Action whose callable tracks its lifetime") {
+        struct Tracked {
+            explicit Tracked (int& alive) : alive{&alive} { ++alive; }
+            Tracked (Tracked&& other) noexcept : alive{other.alive} {
+                ++*alive;
+            }
+            ~Tracked () { --*alive; }
+            void operator () () const {}
+
+            int* alive;
+        };
+
+        int alive = 0;
+        {
+            Inline_Action<void()> action{};
+            action.emplace(Tracked{alive});
+            CHECK(alive == 1);
+
+            WHEN ("another action replaces it") {
+                action.emplace([] {});
+
+                THEN ("the callable is destroyed") {
+                    CHECK(alive == 0);
+                }
+            }
+        }
+
+        THEN ("the callable is destroyed with the Inline_Action") {
+            CHECK(alive == 0);
+        }
+    }
+}
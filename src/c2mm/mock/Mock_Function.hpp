@@ -1,21 +1,39 @@
 #ifndef C2MOCK__MOCK__MOCK_FUNCTION_HPP_
 #define C2MOCK__MOCK__MOCK_FUNCTION_HPP_
 
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <type_traits>
-
-#include <catch2/catch_test_macros.hpp>
+#include <vector>
 
 #include "c2mm/matchers/Tuple_Matcher.hpp"
-#include "c2mm/matchers/Typed_Wrapper.hpp"
+#include "c2mm/mock/Arg_Hasher.hpp"
+#include "c2mm/mock/Call_Expectation.hpp"
 #include "c2mm/mock/Call_Log.hpp"
 #include "c2mm/mock/Default_Action.hpp"
 #include "c2mm/mock/Expectation.hpp"
 #include "c2mm/mock/Expectation_Handle.hpp"
+#include "c2mm/mock/Expectation_Set.hpp"
 #include "c2mm/mock/args.hpp"
+#include "c2mm/mock/capture/Per_Parameter.hpp"
+#include "c2mm/mock/capture/Value.hpp"
 #include "c2mm/mock/reporters/Fail.hpp"
 #include "c2mm/mock/reporters/Fail_Check.hpp"
-#include "c2mm/mp/utils.hpp"
+#include "c2mm/mock/stats/None.hpp"
+#include "c2mm/mock/storage/Counting.hpp"
+#include "c2mm/mock/storage/Heap.hpp"
+#include "c2mm/mock/threading/Single_Threaded.hpp"
+#include "c2mm/mock/trace/Writer.hpp"
+#include "c2mm/mock/trace/format.hpp"
 
 #define FWD(X) std::forward<decltype(X)>(X)
 
@@ -25,7 +43,14 @@ namespace c2mm::mock {
  *
  * See specializations for full documentation.
  */
-template <typename T_Signature, typename T_Log_Reporter = reporters::Fail_Check>
+template <
+    typename T_Signature,
+    typename T_Log_Reporter = reporters::Fail_Check,
+    typename T_Log_Storage = storage::Heap,
+    typename T_Threading = threading::Single_Threaded,
+    typename T_Capture = capture::Value,
+    typename T_Stats = stats::None
+>
 class Mock_Function;
 
 /**
@@ -40,33 +65,94 @@ class Mock_Function;
  * @tparam T_Parameters Types of the mocked function's parameters.
  * @tparam T_Log_Reporter Policy dictating how failures are reported from
  *     unconsumed logged calls.
+ * @tparam T_Log_Storage Policy dictating how logged calls are stored. See the
+ *     policies in @c c2mm::mock::storage.
+ * @tparam T_Threading Policy dictating whether the mock may be called from
+ *     several threads at once. See the policies in @c c2mm::mock::threading.
+ * @tparam T_Capture Policy dictating what is logged of each argument. See the
+ *     policies in @c c2mm::mock::capture.
+ * @tparam T_Stats Policy dictating which runtime statistics are kept. See the
+ *     policies in @c c2mm::mock::stats.
  */
-template <typename T_Return, typename... T_Parameters, typename T_Log_Reporter>
-class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
-    template <typename T>
-    using MatcherBase = Catch::Matchers::MatcherBase<T>;
+template <
+    typename T_Return,
+    typename... T_Parameters,
+    typename T_Log_Reporter,
+    typename T_Log_Storage,
+    typename T_Threading,
+    typename T_Capture,
+    typename T_Stats
+>
+class Mock_Function<
+    T_Return(T_Parameters...),
+    T_Log_Reporter,
+    T_Log_Storage,
+    T_Threading,
+    T_Capture,
+    T_Stats
+> {
+    // Matchers built from argument constraints check cheap constraints first.
+    static constexpr auto cheapest_first =
+        matchers::Evaluation_Order::cheapest_first;
 
   public:
     using Signature = T_Return(T_Parameters...);
+    using Arg_Capture_Type = capture::Arg_Capture<T_Capture, T_Parameters...>;
     using Call_Log_Type = Call_Log<
-        Captured_Args<T_Parameters...>,
-        T_Log_Reporter
+        typename Arg_Capture_Type::Captured,
+        T_Log_Reporter,
+        typename T_Threading::template Log_Storage<T_Log_Storage>
     >;
     using Expectation_Type = Expectation<Signature>;
+    using Call_Expectation_Type = Call_Expectation<Signature>;
+
+  private:
+    // Verifying in order needs a log which keeps calls in order.
+    template <typename T_Order>
+    static constexpr bool supports_order =
+        std::is_same_v<T_Order, Call_Order::Any> or (
+            std::is_same_v<T_Order, Call_Order::In_Order> and
+            Call_Log_Type::keeps_order
+        );
 
+  public:
     /**
      * Construct an instance with a given reporter.
      * @param[in] reporter Callable used to report failures (unconsumed calls).
+     * @param[in] resource Memory resource from which logged calls and
+     *     expectations are allocated. Must outlive this object.
+     */
+    explicit Mock_Function (
+        T_Log_Reporter reporter = T_Log_Reporter{},
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : calls_{std::move(reporter), resource},
+        expectations_{resource},
+        call_expectations_{resource} {}
+
+    /**
+     * Construct an instance with the default reporter which allocates from
+     * @p resource. For example, every mock in a test can share one @c
+     * std::pmr::monotonic_buffer_resource which is released all at once when
+     * the test ends.
+     *
+     * @param[in] resource Memory resource from which logged calls and
+     *     expectations are allocated. Must outlive this object.
      */
-    explicit Mock_Function (T_Log_Reporter reporter = T_Log_Reporter{})
-          : calls_{std::move(reporter)} {}
+    explicit Mock_Function (std::pmr::memory_resource* resource)
+          : Mock_Function{T_Log_Reporter{}, resource} {}
 
     /**
      * When a @c Mock_Function is destroyed, it fails the test if there are any
-     * unconsumed calls.
+     * unconsumed calls or if any expectation or call expectation received
+     * fewer calls than its cardinality requires.
      */
     ~Mock_Function () {
         calls_.check_no_calls();
+
+        report_unsatisfied(call_expectations_);
+        report_unsatisfied(expectations_);
+
+        stats_.publish();
     }
 
     /**
@@ -77,12 +163,47 @@ class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
         return calls_.calls();
     }
 
+    /**
+     * Accessor for the statistics policy, e.g. to name a mock whose policy is
+     * @c stats::Counters.
+     */
+    T_Stats& statistics () { return stats_; }
+
+    /**
+     * Record every call made from now on to @p writer, before it is handled
+     * or logged. Calls are recorded one at a time, even for a multi-threaded
+     * mock.
+     *
+     * Only available if every parameter type is @c Serializable. Must not be
+     * called concurrently with calls to this mock.
+     *
+     * @param[in] writer Destination for the calls. Must outlive this object or
+     *     a later call to @c stop_recording.
+     */
+    void record (trace::Writer<Signature>& writer)
+        requires trace::Recordable<Signature>
+    {
+        recorder_ = &writer;
+    }
+
+    /**
+     * Stop recording calls. Must not be called concurrently with calls to this
+     * mock.
+     */
+    void stop_recording () { recorder_ = nullptr; }
+
     /**
      * Create an @c Expectation for calls that match @p arg_constraints.
      *
      * This is a lower level function that is typically not used by users of
      * this library. Prefer `on_call` bellow.
      *
+     * By default the expectation handles at most one matching call. Use the
+     * returned handle to change the number of calls, e.g. @c times(3). Once
+     * its maximum is reached it is skipped by later calls at no cost. If it
+     * handles fewer calls than its minimum, this is reported when the @c
+     * Mock_Function is destroyed.
+     *
      * @param[in] arg_constraints... Constraints on individual arguments. In
      *     order for an expectation to apply, all arguments must satisfy their
      *     respective constraints.
@@ -93,21 +214,37 @@ class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
     template <typename... T_Constraints>
     Expectation_Handle<Expectation_Type>
     make_expectation (T_Constraints&&... arg_constraints) {
-        using c2mm::matchers::matches;
-        using c2mm::matchers::wrap_for;
-        using c2mm::mp::utils::wrap_unique;
-
-        return expectations_.emplace_back(
-            wrap_unique(
-                wrap_for<Bound_Args<T_Parameters...>>(
-                    matches(
-                        capture_args(
-                            FWD(arg_constraints)...
-                        )
-                    )
-                )
-            )
-        );
+        has_expectations_ = true;
+        return expectations_.add(FWD(arg_constraints)...);
+    }
+
+    /**
+     * Expect calls that match @p arg_constraints.
+     *
+     * Matching calls are verified as they are made rather than logged, so they
+     * need not be consumed with @c check_called and cost no memory. By
+     * default exactly one matching call is expected. Use the returned handle
+     * to expect a different number of calls. A matching call beyond the
+     * maximum is reported when it is made. Expected calls which are never made
+     * are reported when the @c Mock_Function is destroyed. Failures are
+     * reported with the log reporter.
+     *
+     * Each call is counted by the first call expectation, in the order they
+     * were added, whose constraints it satisfies. The call is then still
+     * handled by any matching @c Expectation.
+     *
+     * @param[in] arg_constraints... Constraints on individual arguments. In
+     *     order for a call to be expected, all arguments must satisfy their
+     *     respective constraints.
+     *
+     * @return A builder that can be used to configure the number of calls
+     *     expected.
+     */
+    template <typename... T_Constraints>
+    Expectation_Handle<Call_Expectation_Type>
+    expect_call (T_Constraints&&... arg_constraints) {
+        has_expectations_ = true;
+        return call_expectations_.add(FWD(arg_constraints)...);
     }
 
     /**
@@ -134,12 +271,17 @@ class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
     /**
      * "Call" the mock function.
      *
-     * If there is an expectation that can consume these arguments, delegate to
-     * the first expectation that matches. Otherwise, the call will be logged
+     * If a call expectation (see @c expect_call) matches these arguments, the
+     * call is counted against it. If there is an expectation that can consume
+     * these arguments, delegate to the first expectation that matches.
+     * Otherwise, unless a call expectation counted it, the call will be logged
      * to be checked later. If not consumed by a @c check_called or a @c
      * require_called before the @c Mock_Function object is destroyed, the
      * current Catch2 test will fail.
      *
+     * Until the first expectation or call expectation is added, calls are
+     * logged straight away without looking for expectations.
+     *
      * @param[in] args The arguments of the call.
      *
      * @return @c If consumed, will return the result of the action of the
@@ -147,14 +289,22 @@ class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
      *     of the default action.
      */
     T_Return operator () (T_Parameters&&... args) {
-        auto bound_args = bind_args(args...);
-        for (auto& ex : expectations_) {
-            if (ex.can_consume(bound_args)) {
-                return ex.handle_call(FWD(args)...);
+        if constexpr (trace::Recordable<Signature>) {
+            if (recorder_) {
+                std::scoped_lock lock{expectations_mutex_};
+                recorder_->write(args...);
             }
         }
 
-        calls_.log(FWD(args)...);
+        stats_.count_call();
+
+        // Mocks which only absorb calls never bind their arguments or look at
+        // expectations.
+        if (has_expectations_) {
+            return dispatch(FWD(args)...);
+        }
+
+        log_call(FWD(args)...);
         return Default_Action<T_Return>{}();
     }
 
@@ -165,7 +315,8 @@ class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
      * arg_constraints. For each constraint that is a matcher, the comparison
      * is equivalent to `constraint.match(value)`. Otherwise, the comparison is
      * `operator ==`. All comparisons must resolve to @c true for a call to be
-     * matched.
+     * matched. Constraints are first adapted to what the capture policy of
+     * each parameter logged.
      *
      * Once a call is matched, it is consumed and cannot match another set of
      * constraints in a future validation.
@@ -183,11 +334,14 @@ class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
         T_Reporter reporter,
         T_Constraints const&... arg_constraints
     ) {
-        auto matcher = matchers::matches(bind_args(arg_constraints...));
+        [[maybe_unused]] auto const timer = stats_.time_scan();
+        auto matcher = matchers::matches<cheapest_first>(
+            Arg_Capture_Type::constraints(arg_constraints...)
+        );
 
         if (not calls_.consume_match(matcher)) {
             // TODO(emery): Print out constraints.
-            reporter("No call whose arguments match.");
+            report_no_match(reporter, "No call whose arguments match.");
         }
     }
 
@@ -217,9 +371,612 @@ class Mock_Function<T_Return(T_Parameters...), T_Log_Reporter> {
         validate_called(reporters::Fail{}, arg_constraints...);
     }
 
+    /**
+     * Wait up to @p timeout for a call whose arguments match @p
+     * arg_constraints to be logged, and consume it.
+     *
+     * Calls are matched as in @c validate_called, whether they were logged
+     * before or during the wait. Calls consumed by an expectation or counted
+     * by a call expectation are never logged and so never match. The wait
+     * ends as soon as a matching call is logged; it does not poll.
+     *
+     * Only the @c threading::Multi_Threaded policy blocks. With other
+     * policies no other thread may call the mock, so the log is checked once.
+     *
+     * @param[in] timeout Maximum time to wait.
+     * @param[in] arg_constraints Constraints to check against arguments.
+     *
+     * @return @c true if a matching call was consumed. Else returns @c false.
+     */
+    template <typename T_Rep, typename T_Period, typename... T_Constraints>
+    [[nodiscard]] bool wait_for_call (
+        std::chrono::duration<T_Rep, T_Period> const& timeout,
+        T_Constraints const&... arg_constraints
+    ) {
+        auto matcher = matchers::matches<cheapest_first>(
+            Arg_Capture_Type::constraints(arg_constraints...)
+        );
+
+        return logged_signal_.wait_until(
+            std::chrono::steady_clock::now() + timeout,
+            [&] { return calls_.consume_match(matcher); }
+        );
+    }
+
+    /**
+     * Wait up to @p timeout for at least @p count unconsumed calls to be
+     * logged.
+     *
+     * The calls are not consumed, so that they can then be verified with @c
+     * check_called or @c check_all_called. As with @c wait_for_call, only
+     * logged calls are counted and only the @c threading::Multi_Threaded
+     * policy blocks.
+     *
+     * @param[in] count Number of unconsumed calls to wait for.
+     * @param[in] timeout Maximum time to wait.
+     *
+     * @return @c true if @p count calls were logged. Else returns @c false.
+     */
+    template <typename T_Rep, typename T_Period>
+    [[nodiscard]] bool wait_for_calls (
+        std::size_t count,
+        std::chrono::duration<T_Rep, T_Period> const& timeout
+    ) {
+        return logged_signal_.wait_until(
+            std::chrono::steady_clock::now() + timeout,
+            [&] { return calls_.size() >= count; }
+        );
+    }
+
+    /**
+     * Check for one past call per set of constraints in @p constraint_sets.
+     *
+     * Each element of @p constraint_sets is a @c std::tuple with one
+     * constraint per argument, compared to arguments as in @c validate_called.
+     * Each matched call is consumed and matches only one set of constraints.
+     * Unlike calling @c validate_called once per set, the log is traversed
+     * only once and every set of constraints left unmatched is reported.
+     *
+     * With @c Call_Order::in_order, the sets must match calls in the order
+     * they were logged, though other calls may be logged in between. Once a
+     * set goes unmatched, it and every set after it are reported.
+     * Only available if the log keeps calls in the order they were logged,
+     * which the sharded log of @c threading::Multi_Threaded does not.
+     *
+     * With @c Call_Order::any, as many sets as possible are matched, each to a
+     * different call. When every constraint is an exact value of an integral,
+     * enum or string argument, as logged by the capture policy, each call is
+     * only checked against sets with the same hash and claims the first
+     * unmatched set which accepts it. Such sets accept the same calls when
+     * they accept any call in common, so claiming the first one loses
+     * nothing. Otherwise, each call is checked against every set, and a set
+     * claimed by an earlier call is taken over if that call can be moved to
+     * another set. Calls are visited once, in the order they were logged.
+     *
+     * This is a lower level function that is typically not used by users of
+     * this library. Prefer one of `check_all_called` or `require_all_called`
+     * bellow.
+     *
+     * @param[out] reporter Callable used to report each set of constraints
+     *     which matches no logged call.
+     * @param[in] order Whether the sets must match calls in order.
+     * @param[in] constraint_sets Range of sets of constraints to check against
+     *     arguments of logged calls.
+     */
+    template <
+        typename T_Reporter,
+        typename T_Order,
+        typename T_Constraint_Sets
+    >
+        requires supports_order<T_Order> and
+            std::ranges::forward_range<T_Constraint_Sets const> and
+            std::is_lvalue_reference_v<
+                std::ranges::range_reference_t<T_Constraint_Sets const>
+            >
+    void validate_all_called (
+        T_Reporter reporter,
+        [[maybe_unused]] T_Order order,
+        T_Constraint_Sets const& constraint_sets
+    ) {
+        using Arg_Tuple = typename Call_Log_Type::Arg_Tuple;
+        using Hasher = arg_hasher_for_t<Arg_Tuple>;
+
+        [[maybe_unused]] auto const timer = stats_.time_scan();
+
+        // Adapt each set to what the capture policies logged once, rather
+        // than once per call.
+        auto const adapt = [] (auto const& set) {
+            return std::apply(
+                [] (auto const&... constraints) {
+                    return Arg_Capture_Type::constraints(constraints...);
+                },
+                set
+            );
+        };
+        using Set = decltype(adapt(*std::ranges::begin(constraint_sets)));
+
+        std::vector<Set> sets{};
+        for (auto const& set : constraint_sets) {
+            sets.push_back(adapt(set));
+        }
+
+        // Each matcher refers to the constraints of its set, which stay put
+        // from here on.
+        using Set_Matcher = decltype(set_matcher(std::declval<Set const&>()));
+        std::vector<Set_Matcher> set_matchers{};
+        set_matchers.reserve(sets.size());
+        for (auto const& set : sets) {
+            set_matchers.push_back(set_matcher(set));
+        }
+
+        if constexpr (std::is_same_v<T_Order, Call_Order::In_Order>) {
+            std::size_t num_matched = 0;
+            calls_.consume_if([&] (Arg_Tuple const& call) {
+                if (num_matched < sets.size() and
+                    set_matchers[num_matched].match(call)
+                ) {
+                    ++num_matched;
+                    return true;
+                }
+                return false;
+            });
+
+            for (auto idx = num_matched; idx < sets.size(); ++idx) {
+                report_no_match(
+                    reporter,
+                    "No call, in order, whose arguments match constraint set " +
+                        std::to_string(idx) + "."
+                );
+            }
+            return;
+        }
+
+        std::vector<bool> matched(sets.size(), false);
+
+        if constexpr (Hasher::template can_hash_constraint_set<Set>()) {
+            // Candidate sets for some calls, in the order given. Sets before
+            // `first_unmatched` are all matched already.
+            struct Candidates {
+                std::vector<std::size_t> sets{};
+                std::size_t first_unmatched = 0;
+            };
+
+            auto const claim = [&] (Candidates& cands, Arg_Tuple const& call) {
+                for (auto pos = cands.first_unmatched;
+                    pos < cands.sets.size();
+                    ++pos
+                ) {
+                    auto const idx = cands.sets[pos];
+                    if (not matched[idx] and set_matchers[idx].match(call)) {
+                        matched[idx] = true;
+                        while (cands.first_unmatched < cands.sets.size() and
+                            matched[cands.sets[cands.first_unmatched]]
+                        ) {
+                            ++cands.first_unmatched;
+                        }
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            std::unordered_map<std::size_t, Candidates> by_hash{};
+            for (std::size_t idx = 0; idx < sets.size(); ++idx) {
+                auto const hash = std::apply(
+                    [] (auto const&... constraints) {
+                        return Hasher::hash_constraints(constraints...);
+                    },
+                    sets[idx]
+                );
+                by_hash[hash].sets.push_back(idx);
+            }
+
+            calls_.consume_if([&] (Arg_Tuple const& call) {
+                auto const iter = by_hash.find(Hasher::hash_args(call));
+                return iter != by_hash.end() and claim(iter->second, call);
+            });
+        } else {
+            // A maximum bipartite matching of calls to sets, found with
+            // augmenting paths. The sets each consumed call accepts, and the
+            // consumed call each set is matched to, are kept so that a later
+            // call can take over a set whose call can move to another one.
+            constexpr auto no_call = static_cast<std::size_t>(-1);
+            std::vector<std::vector<std::size_t>> accepted_by{};
+            std::vector<std::size_t> owner(sets.size(), no_call);
+            std::vector<std::size_t> visited_by(sets.size(), no_call);
+            std::size_t num_attempts = 0;
+
+            auto const augment = [&] (
+                auto const& self,
+                std::size_t call_idx,
+                std::size_t visitor
+            ) -> bool {
+                for (auto const idx : accepted_by[call_idx]) {
+                    if (visited_by[idx] == visitor) {
+                        continue;
+                    }
+                    visited_by[idx] = visitor;
+                    if (owner[idx] == no_call or
+                        self(self, owner[idx], visitor)
+                    ) {
+                        owner[idx] = call_idx;
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            calls_.consume_if([&] (Arg_Tuple const& call) {
+                std::vector<std::size_t> accepted{};
+                for (std::size_t idx = 0; idx < sets.size(); ++idx) {
+                    if (set_matchers[idx].match(call)) {
+                        accepted.push_back(idx);
+                    }
+                }
+
+                auto const call_idx = accepted_by.size();
+                for (auto const idx : accepted) {
+                    if (owner[idx] == no_call) {
+                        owner[idx] = call_idx;
+                        accepted_by.push_back(std::move(accepted));
+                        return true;
+                    }
+                }
+
+                accepted_by.push_back(std::move(accepted));
+                if (augment(augment, call_idx, num_attempts++)) {
+                    return true;
+                }
+                accepted_by.pop_back();
+                return false;
+            });
+
+            for (std::size_t idx = 0; idx < sets.size(); ++idx) {
+                matched[idx] = owner[idx] != no_call;
+            }
+        }
+
+        for (std::size_t idx = 0; idx < sets.size(); ++idx) {
+            if (not matched[idx]) {
+                report_no_match(
+                    reporter,
+                    "No call whose arguments match constraint set " +
+                        std::to_string(idx) + "."
+                );
+            }
+        }
+    }
+
+    /**
+     * Check for one past call per set of constraints in @p constraint_sets.
+     * See @c validate_all_called.
+     *
+     * Each set of constraints which matches no call is effectively a failed
+     * Catch2 CHECK. It fails the test but continues executing.
+     *
+     * @param[in] constraint_sets Range of @c std::tuple of constraints to
+     *     check against arguments.
+     * @param[in] order Whether the sets must match calls in order.
+     */
+    template <
+        typename T_Constraint_Sets,
+        typename T_Order = Call_Order::Any
+    >
+        requires supports_order<T_Order>
+    void check_all_called (
+        T_Constraint_Sets const& constraint_sets,
+        T_Order order = Call_Order::any
+    ) {
+        validate_all_called(reporters::Fail_Check{}, order, constraint_sets);
+    }
+
+    /**
+     * Check for one past call per set of constraints in @p constraint_sets.
+     * See @c validate_all_called.
+     *
+     * If any set of constraints matches no call this is effectively a failed
+     * Catch2 REQUIRE. Every unmatched set is reported before the test stops.
+     *
+     * @param[in] constraint_sets Range of @c std::tuple of constraints to
+     *     check against arguments.
+     * @param[in] order Whether the sets must match calls in order.
+     */
+    template <
+        typename T_Constraint_Sets,
+        typename T_Order = Call_Order::Any
+    >
+        requires supports_order<T_Order>
+    void require_all_called (
+        T_Constraint_Sets const& constraint_sets,
+        T_Order order = Call_Order::any
+    ) {
+        std::size_t num_unmatched = 0;
+        validate_all_called(
+            [&num_unmatched] (std::string_view message) {
+                ++num_unmatched;
+                reporters::Fail_Check{}(message);
+            },
+            order,
+            constraint_sets
+        );
+
+        if (num_unmatched > 0) {
+            reporters::Fail{}(
+                std::to_string(num_unmatched) +
+                " constraint set(s) matched no call."
+            );
+        }
+    }
+
+    /**
+     * Register a bucket which counts logged calls that match @p
+     * arg_constraints.
+     *
+     * Only available with the @c storage::Counting log storage policy, which
+     * does not capture arguments. Each logged call is counted in the first
+     * bucket whose constraints it satisfies. Use @c check_call_count or @c
+     * require_call_count with the returned identifier to verify and consume
+     * the calls counted in the bucket.
+     *
+     * @param[in] arg_constraints... Constraints on individual arguments.
+     *
+     * @return Identifier of the bucket.
+     */
+    template <typename... T_Constraints>
+        requires requires (typename Call_Log_Type::Call_List& list) {
+            list.take(storage::Bucket_Id{});
+        }
+    storage::Bucket_Id count_calls (T_Constraints&&... arg_constraints) {
+        using c2mm::matchers::matches;
+        using c2mm::matchers::wrap_for;
+
+        auto constraints = std::apply(
+            [] (auto&&... adapted) { return capture_args(FWD(adapted)...); },
+            Arg_Capture_Type::constraints(FWD(arg_constraints)...)
+        );
+        auto& list = calls_.storage();
+        return list.add_bucket({
+            std::allocator_arg,
+            list.resource(),
+            wrap_for<bound_args_for_t<typename Arg_Capture_Type::Captured>>(
+                matches<cheapest_first>(std::move(constraints))
+            ),
+        });
+    }
+
+    /**
+     * Check that exactly @p expected calls are logged and consume them all.
+     *
+     * This is a lower level function that is typically not used by users of
+     * this library. Prefer one of `check_call_count` or `require_call_count`
+     * bellow.
+     *
+     * @param[out] reporter Callable used to report a mismatched count.
+     * @param[in] expected The number of unconsumed logged calls expected.
+     */
+    template <typename T_Reporter>
+    void validate_call_count (T_Reporter reporter, std::size_t expected) {
+        auto const actual = calls_.size();
+        calls_.clear();
+        report_count_mismatch(reporter, expected, actual);
+    }
+
+    /**
+     * Check that exactly @p expected calls are counted in @p bucket and
+     * consume them.
+     *
+     * Only available with the @c storage::Counting log storage policy.
+     *
+     * @param[out] reporter Callable used to report a mismatched count.
+     * @param[in] bucket A bucket returned by @c count_calls.
+     * @param[in] expected The number of unconsumed calls expected in @p
+     *     bucket.
+     */
+    template <typename T_Reporter>
+    void validate_call_count (
+        T_Reporter reporter,
+        storage::Bucket_Id bucket,
+        std::size_t expected
+    ) {
+        auto const actual = calls_.storage().take(bucket);
+        report_count_mismatch(reporter, expected, actual);
+    }
+
+    /**
+     * Check that exactly @p expected calls are logged and consume them all.
+     *
+     * If the count differs this is effectively a failed Catch2 CHECK.
+     *
+     * @param[in] expected The number of unconsumed logged calls expected.
+     */
+    void check_call_count (std::size_t expected) {
+        validate_call_count(reporters::Fail_Check{}, expected);
+    }
+
+    /**
+     * Check that exactly @p expected calls are counted in @p bucket and
+     * consume them.
+     *
+     * If the count differs this is effectively a failed Catch2 CHECK.
+     *
+     * @param[in] bucket A bucket returned by @c count_calls.
+     * @param[in] expected The number of unconsumed calls expected in @p
+     *     bucket.
+     */
+    void check_call_count (storage::Bucket_Id bucket, std::size_t expected) {
+        validate_call_count(reporters::Fail_Check{}, bucket, expected);
+    }
+
+    /**
+     * Check that exactly @p expected calls are logged and consume them all.
+     *
+     * If the count differs this is effectively a failed Catch2 REQUIRE.
+     *
+     * @param[in] expected The number of unconsumed logged calls expected.
+     */
+    void require_call_count (std::size_t expected) {
+        validate_call_count(reporters::Fail{}, expected);
+    }
+
+    /**
+     * Check that exactly @p expected calls are counted in @p bucket and
+     * consume them.
+     *
+     * If the count differs this is effectively a failed Catch2 REQUIRE.
+     *
+     * @param[in] bucket A bucket returned by @c count_calls.
+     * @param[in] expected The number of unconsumed calls expected in @p
+     *     bucket.
+     */
+    void require_call_count (storage::Bucket_Id bucket, std::size_t expected) {
+        validate_call_count(reporters::Fail{}, bucket, expected);
+    }
+
   private:
+    // Count the call against the call expectations and handle it with the
+    // first matching expectation, or else log it. The handler's action runs
+    // after the lock is released so that it may call this mock again.
+    // Expectations never move and are only destroyed with the mock, so the
+    // handler outlives the lock.
+    T_Return dispatch (T_Parameters&&... args) {
+        // Call expectations never saturate, so finding one doesn't change
+        // their set, and they count calls atomically. Without any other
+        // expectation, calls only take the lock to report an excess call.
+        if (expectations_.empty()) {
+            auto const bound = bind_args(args...);
+            Call_Expectation_Type* ex = nullptr;
+            bool is_excess = false;
+            {
+                [[maybe_unused]] auto const timer = stats_.time_matching();
+                ex = call_expectations_.find(bound);
+                is_excess = ex and not ex->record_call();
+            }
+
+            if (is_excess) {
+                std::scoped_lock lock{expectations_mutex_};
+                report_excess_call(*ex);
+            }
+            if (not ex) {
+                log_call(FWD(args)...);
+            }
+            return Default_Action<T_Return>{}();
+        }
+
+        bool expected = false;
+        Expectation_Type* handler = nullptr;
+
+        {
+            std::scoped_lock lock{expectations_mutex_};
+            auto const bound = bind_args(args...);
+
+            {
+                [[maybe_unused]] auto const timer = stats_.time_matching();
+
+                if (not call_expectations_.empty()) {
+                    if (auto* ex = call_expectations_.find(bound)) {
+                        expected = true;
+                        if (not ex->record_call()) {
+                            report_excess_call(*ex);
+                        }
+                    }
+                }
+
+                if (not expectations_.empty()) {
+                    handler = expectations_.find(bound);
+                }
+            }
+
+            if (handler) {
+                stats_.count_handled();
+                handler->record_call();
+            }
+        }
+
+        if (handler) {
+            return handler->run_action(FWD(args)...);
+        }
+        if (not expected) {
+            log_call(FWD(args)...);
+        }
+        return Default_Action<T_Return>{}();
+    }
+
+    void report_excess_call (Call_Expectation_Type const& ex) {
+        calls_.reporter()(
+            "Unexpected call: expected " + ex.cardinality().describe() +
+            " but this is call " + std::to_string(ex.call_count()) + "."
+        );
+    }
+
+    void log_call (T_Parameters&&... args) {
+        Arg_Capture_Type::log(calls_, FWD(args)...);
+        stats_.count_logged(calls_);
+        logged_signal_.notify();
+    }
+
+    // Matcher of logged calls referring to the constraints of `set`, which
+    // must outlive it.
+    template <typename T_Set>
+    static auto set_matcher (T_Set const& set) {
+        return std::apply(
+            [] (auto const&... constraints) {
+                return matchers::matches<cheapest_first>(
+                    bind_args(constraints...)
+                );
+            },
+            set
+        );
+    }
+
+    // Report each expectation in `set` which received too few calls. Only
+    // done once, on destruction, so calls never pay for it.
+    template <typename T_Set>
+    void report_unsatisfied (T_Set const& set) {
+        set.for_each([this] (auto const& expected) {
+            if (not expected.is_satisfied()) {
+                calls_.reporter()(
+                    "Expected " + expected.cardinality().describe() +
+                    " but " + std::to_string(expected.call_count()) +
+                    " were made."
+                );
+            }
+        });
+    }
+
+    template <typename T_Reporter>
+    void report_no_match (T_Reporter& reporter, std::string message) const {
+        if (auto const num_dropped = calls_.dropped(); num_dropped > 0) {
+            message += " " + std::to_string(num_dropped) +
+                " call(s) were dropped from the log.";
+        }
+        reporter(std::move(message));
+    }
+
+    template <typename T_Reporter>
+    static void report_count_mismatch (
+        T_Reporter& reporter,
+        std::size_t expected,
+        std::size_t actual
+    ) {
+        if (actual != expected) {
+            reporter(
+                "Expected " + std::to_string(expected) + " call(s) but " +
+                std::to_string(actual) + " were logged."
+            );
+        }
+    }
+
     Call_Log_Type calls_;
-    std::vector<Expectation_Type> expectations_;
+    Expectation_Set<Signature> expectations_;
+    Expectation_Set<Signature, Call_Expectation_Type> call_expectations_;
+    // Set when the first expectation of either kind is added. Like the
+    // expectations themselves, it must not change once calls are concurrent.
+    bool has_expectations_ = false;
+    [[no_unique_address]] typename T_Threading::Mutex expectations_mutex_;
+    [[no_unique_address]]
+    typename T_Threading::Call_Signal logged_signal_;
+    trace::Writer<Signature>* recorder_ = nullptr;
+    [[no_unique_address]] T_Stats stats_;
 };
 }  // namespace c2mm::mock
 
@@ -1,14 +1,37 @@
 #include "c2mm/mock/Mock_Function.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <memory_resource>
 #include <optional>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/cx/Comparison.hpp"
+#include "c2mm/mock/capture/Drop.hpp"
+#include "c2mm/mock/capture/Fingerprint.hpp"
+#include "c2mm/mock/capture/Project.hpp"
 #include "c2mm/mock/reporters/Mock.hpp"
+#include "c2mm/mock/storage/Chunked.hpp"
+#include "c2mm/mock/storage/Counting.hpp"
+#include "c2mm/mock/storage/Ring.hpp"
+#include "c2mm/mock/threading/Multi_Threaded.hpp"
+
+namespace {
+template <typename T_Func, typename T_Order>
+constexpr bool can_verify_in = requires (T_Func& func, T_Order order) {
+    func.check_all_called(std::vector<std::tuple<int>>{}, order);
+};
+}  // namespace
 
 SCENARIO ("If all calls are consumed, Mock_Function doesn't fail.") {
     GIVEN ("a Mock_Function") {
@@ -80,3 +103,823 @@ SCENARIO ("Mock_Function fails when calls aren't matched.") {
         }
     }
 }
+
+SCENARIO ("A multi-threaded Mock_Function can be called concurrently.") {
+    GIVEN ("a multi-threaded Mock_Function") {
+        using c2mm::mock::Mock_Function;
+        using Func = Mock_Function<
+            void(int, int),
+            reporters::Mock_Ref,
+            c2mm::mock::storage::Chunked<>,
+            c2mm::mock::threading::Multi_Threaded<>
+        >;
+
+        reporters::Mock mock_reporter{};
+        auto func_ptr = std::make_unique<Func>(std::ref(mock_reporter));
+        auto& func = *func_ptr;
+
+        constexpr int num_threads = 4;
+        constexpr int num_calls = 200;
+
+        WHEN ("an expectation is set and several threads call it at once") {
+            func.make_expectation(2, 17);
+
+            std::vector<std::thread> threads{};
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&func, t] {
+                    for (int i = 0; i < num_calls; ++i) {
+                        func(int{t}, int{i});
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            THEN ("the expectation consumed exactly one call") {
+                CHECK(func.calls().size() == num_threads * num_calls - 1);
+
+                for (int t = 0; t < num_threads; ++t) {
+                    for (int i = 0; i < num_calls; ++i) {
+                        if (t != 2 or i != 17) {
+                            func.check_called(t, i);
+                        }
+                    }
+                }
+
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+
+        WHEN ("only calls are expected and several threads make them at once") {
+            func.expect_call(0, 0).times(num_threads * num_calls);
+
+            std::vector<std::thread> threads{};
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&func, t] {
+                    for (int i = 0; i < num_calls; ++i) {
+                        func(0, 0);
+                        func(int{t + 1}, int{i});
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            THEN ("every expected call is counted and the rest are logged") {
+                CHECK(func.calls().size() == num_threads * num_calls);
+
+                for (int t = 0; t < num_threads; ++t) {
+                    for (int i = 0; i < num_calls; ++i) {
+                        func.check_called(t + 1, i);
+                    }
+                }
+
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO ("Actions of a multi-threaded Mock_Function run outside its lock.") {
+    using c2mm::mock::Mock_Function;
+    using Func = Mock_Function<
+        int(int),
+        reporters::Fail_Check,
+        c2mm::mock::storage::Chunked<>,
+        c2mm::mock::threading::Multi_Threaded<>
+    >;
+
+    constexpr int num_threads = 4;
+
+    GIVEN ("a multi-threaded Mock_Function whose actions call it again") {
+        Func func{};
+        func.make_expectation(0).at_least(1).returns(1);
+        func.make_expectation(1).at_least(1).execute([&func] (int n) {
+            return func(n - 1) + 1;
+        });
+
+        WHEN ("it is called from several threads at once") {
+            constexpr int num_calls = 200;
+
+            std::atomic<int> total{0};
+            std::vector<std::thread> threads{};
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&func, &total] {
+                    for (int i = 0; i < num_calls; ++i) {
+                        total += func(1);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            THEN ("every nested call is handled") {
+                CHECK(total == 2 * num_threads * num_calls);
+                CHECK(func.calls().size() == 0);
+            }
+        }
+    }
+
+    GIVEN ("a multi-threaded Mock_Function returning a sequence") {
+        Func func{};
+        func.make_expectation(2).at_least(1).returns_in_sequence(0, 1, 2, 3, 4);
+
+        WHEN ("several threads call it at once") {
+            std::vector<int> results(num_threads);
+            std::vector<std::thread> threads{};
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&func, &result = results[t]] {
+                    result = func(2);
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            THEN ("each takes a different value") {
+                std::ranges::sort(results);
+                CHECK(results == std::vector{0, 1, 2, 3});
+                CHECK(func(2) == 4);
+                CHECK(func(2) == 4);
+            }
+        }
+    }
+}
+
+SCENARIO ("A test can wait for calls made by another thread.") {
+    using namespace std::chrono_literals;
+
+    GIVEN ("a multi-threaded Mock_Function") {
+        c2mm::mock::Mock_Function<
+            void(int),
+            reporters::Fail_Check,
+            c2mm::mock::storage::Chunked<>,
+            c2mm::mock::threading::Multi_Threaded<>
+        > func{};
+
+        WHEN ("another thread calls it while the test waits") {
+            std::jthread producer{[&func] {
+                for (int i = 0; i < 5; ++i) {
+                    std::this_thread::sleep_for(1ms);
+                    func(int{i});
+                }
+            }};
+
+            THEN ("the wait ends with the matching call consumed") {
+                CHECK(func.wait_for_call(10s, 3));
+                CHECK(func.wait_for_calls(4, 10s));
+                producer.join();
+                func.check_all_called(std::vector{
+                    std::tuple{0},
+                    std::tuple{1},
+                    std::tuple{2},
+                    std::tuple{4},
+                });
+            }
+        }
+
+        WHEN ("no matching call is made") {
+            func(1);
+
+            THEN ("the wait times out") {
+                auto const start = std::chrono::steady_clock::now();
+                CHECK_FALSE(func.wait_for_call(20ms, 2));
+                CHECK_FALSE(func.wait_for_calls(2, 20ms));
+                CHECK(std::chrono::steady_clock::now() - start >= 40ms);
+                func.check_called(1);
+            }
+        }
+    }
+
+    GIVEN ("a single-threaded Mock_Function") {
+        c2mm::mock::Mock_Function<void(int)> func{};
+        func(1);
+
+        THEN ("waits check the log without blocking") {
+            CHECK(func.wait_for_calls(1, 1h));
+            CHECK(func.wait_for_call(1h, 1));
+            CHECK_FALSE(func.wait_for_call(1h, 1));
+        }
+    }
+}
+
+SCENARIO ("A bounded Mock_Function mentions dropped calls in failures.") {
+    GIVEN ("a Mock_Function which keeps only one call") {
+        using c2mm::mock::Mock_Function;
+        using Func = Mock_Function<
+            void(int),
+            reporters::Mock_Ref,
+            c2mm::mock::storage::Ring<1>
+        >;
+
+        reporters::Mock mock_reporter{};
+        auto func_ptr = std::make_unique<Func>(std::ref(mock_reporter));
+        auto& func = *func_ptr;
+
+        WHEN ("more calls are made than it keeps") {
+            func(1);
+            func(2);
+            func(3);
+
+            THEN ("a failed validation mentions the dropped calls") {
+                func.validate_called(std::ref(mock_reporter), 1);
+                mock_reporter.check_called(
+                    "No call whose arguments match. "
+                    "2 call(s) were dropped from the log."
+                );
+
+                func.check_called(3);
+                func_ptr.reset();
+                mock_reporter.check_called(
+                    "2 unconsumed call(s) dropped from the log"
+                );
+            }
+        }
+    }
+}
+
+SCENARIO ("A counting Mock_Function verifies calls by count.") {
+    GIVEN ("a Mock_Function which only counts calls") {
+        using c2mm::mock::Mock_Function;
+        using Func = Mock_Function<
+            void(int),
+            reporters::Mock_Ref,
+            c2mm::mock::storage::Counting
+        >;
+
+        reporters::Mock mock_reporter{};
+        auto func_ptr = std::make_unique<Func>(std::ref(mock_reporter));
+        auto& func = *func_ptr;
+
+        using c2mm::matchers::greater_than;
+        auto const big = func.count_calls(greater_than(100));
+
+        WHEN ("calls are made") {
+            for (int i = 0; i < 1000; ++i) {
+                func(int{i});
+            }
+
+            THEN ("they can be verified by bucket and in total") {
+                func.check_call_count(big, 899);
+                func.check_call_count(101);
+
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+
+            THEN ("a mismatched count is reported") {
+                func.validate_call_count(std::ref(mock_reporter), big, 5);
+                mock_reporter.check_called(
+                    "Expected 5 call(s) but 899 were logged."
+                );
+
+                func_ptr.reset();
+                mock_reporter.check_called("101 unconsumed call(s)");
+            }
+        }
+    }
+}
+
+SCENARIO ("A multi-threaded counting Mock_Function reports calls once.") {
+    GIVEN ("a multi-threaded Mock_Function which only counts calls") {
+        using c2mm::mock::Mock_Function;
+        using Func = Mock_Function<
+            void(int),
+            reporters::Mock_Ref,
+            c2mm::mock::storage::Counting,
+            c2mm::mock::threading::Multi_Threaded<>
+        >;
+
+        reporters::Mock mock_reporter{};
+        auto func_ptr = std::make_unique<Func>(std::ref(mock_reporter));
+        auto& func = *func_ptr;
+
+        WHEN ("calls from several threads are left unconsumed") {
+            std::thread other{[&func] { func(1); }};
+            func(2);
+            other.join();
+
+            THEN ("they are reported once, by count") {
+                CHECK(func.calls().begin() == func.calls().end());
+
+                func_ptr.reset();
+                mock_reporter.check_called("2 unconsumed call(s)");
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+
+        WHEN ("calls are counted in total") {
+            func(1);
+            func(2);
+
+            THEN ("the total is verified") {
+                func.check_call_count(2);
+
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO ("Mock_Function verifies many calls at once.") {
+    GIVEN ("a Mock_Function with some logged calls") {
+        using c2mm::mock::Call_Order;
+        using c2mm::mock::Mock_Function;
+        using Func = Mock_Function<
+            void(int, std::string),
+            reporters::Mock_Ref,
+            c2mm::mock::storage::Chunked<>
+        >;
+
+        reporters::Mock mock_reporter{};
+        auto func_ptr = std::make_unique<Func>(std::ref(mock_reporter));
+        auto& func = *func_ptr;
+
+        for (int i = 0; i < 100; ++i) {
+            func(int{i}, std::to_string(i % 3));
+        }
+
+        WHEN ("exact values are verified in any order") {
+            std::vector<std::tuple<int, std::string>> expected{};
+            for (int i = 99; i >= 0; --i) {
+                expected.emplace_back(i, std::to_string(i % 3));
+            }
+            func.validate_all_called(
+                std::ref(mock_reporter),
+                Call_Order::any,
+                expected
+            );
+
+            THEN ("every call is consumed") {
+                CHECK(func.calls().size() == 0);
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+
+        WHEN ("matchers are verified in order") {
+            using c2mm::matchers::greater_than;
+            using c2mm::matchers::less_than;
+            using Set = std::tuple<
+                c2mm::matchers::Comparison_Matcher<int, std::less<>>,
+                std::string
+            >;
+            std::vector<Set> const expected{
+                {less_than(10), std::string{"1"}},
+                {less_than(10), std::string{"1"}},
+                {less_than(10), std::string{"1"}},
+                {less_than(10), std::string{"1"}},
+            };
+            func.validate_all_called(
+                std::ref(mock_reporter),
+                Call_Order::in_order,
+                expected
+            );
+
+            THEN ("matching calls are consumed and the rest are reported") {
+                CHECK(func.calls().size() == 97);
+                mock_reporter.check_called(
+                    "No call, in order, whose arguments match constraint set 3."
+                );
+                CHECK(mock_reporter.calls().size() == 0);
+                func.validate_call_count(std::ref(mock_reporter), 97);
+            }
+        }
+
+        WHEN ("overlapping matchers are verified in any order") {
+            using c2mm::matchers::less_than;
+            using Set = std::tuple<
+                c2mm::matchers::Comparison_Matcher<int, std::less<>>,
+                std::string
+            >;
+            // The first call matches both sets. It must leave the first set
+            // to a later call, since only it matches the second set.
+            std::vector<Set> const expected{
+                {less_than(100), std::string{"0"}},
+                {less_than(1), std::string{"0"}},
+            };
+            func.validate_all_called(
+                std::ref(mock_reporter),
+                Call_Order::any,
+                expected
+            );
+
+            THEN ("every set is matched") {
+                CHECK(mock_reporter.calls().size() == 0);
+                CHECK(func.calls().size() == 98);
+                func.validate_call_count(std::ref(mock_reporter), 98);
+            }
+        }
+
+        WHEN ("some sets of constraints match nothing") {
+            std::vector<std::tuple<int, std::string>> const expected{
+                {5, "2"},
+                {5, "0"},
+                {7, "1"},
+                {7, "1"},
+                {-1, "2"},
+            };
+            func.validate_all_called(
+                std::ref(mock_reporter),
+                Call_Order::any,
+                expected
+            );
+
+            THEN ("each unmatched set is reported") {
+                mock_reporter.check_called(
+                    "No call whose arguments match constraint set 1."
+                );
+                mock_reporter.check_called(
+                    "No call whose arguments match constraint set 3."
+                );
+                mock_reporter.check_called(
+                    "No call whose arguments match constraint set 4."
+                );
+                CHECK(func.calls().size() == 98);
+                func.validate_call_count(std::ref(mock_reporter), 98);
+            }
+        }
+    }
+}
+
+TEST_CASE ("Mock_Function only verifies in order if calls are in order.") {
+    using c2mm::mock::Call_Order;
+    using c2mm::mock::Mock_Function;
+    using Multi_Threaded_Func = Mock_Function<
+        void(int),
+        reporters::Fail_Check,
+        c2mm::mock::storage::Chunked<>,
+        c2mm::mock::threading::Multi_Threaded<>
+    >;
+
+    using Func = Mock_Function<void(int)>;
+    STATIC_CHECK(can_verify_in<Func, Call_Order::In_Order>);
+    STATIC_CHECK(can_verify_in<Multi_Threaded_Func, Call_Order::Any>);
+
+    // The shards of the log are visited one after another, not in the order
+    // calls were logged.
+    STATIC_CHECK(not can_verify_in<Multi_Threaded_Func, Call_Order::In_Order>);
+}
+
+SCENARIO ("Mock_Function verifies expected calls as they are made.") {
+    GIVEN ("a Mock_Function with call expectations") {
+        using c2mm::mock::Mock_Function;
+        using Func = Mock_Function<void(int), reporters::Mock_Ref>;
+
+        reporters::Mock mock_reporter{};
+        auto func_ptr = std::make_unique<Func>(std::ref(mock_reporter));
+        auto& func = *func_ptr;
+
+        using c2mm::matchers::greater_than;
+        func.expect_call(1);
+        func.expect_call(2).times(3);
+        func.expect_call(greater_than(100)).at_least(1);
+
+        WHEN ("the expected calls are made") {
+            func(1);
+            for (int i = 0; i < 3; ++i) {
+                func(2);
+            }
+            for (int i = 0; i < 1000; ++i) {
+                func(101 + i);
+            }
+
+            THEN ("none of them are logged") {
+                CHECK(func.calls().size() == 0);
+
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+
+        WHEN ("too many calls are made") {
+            func(1);
+            func(1);
+
+            THEN ("the excess call is reported immediately") {
+                mock_reporter.check_called(
+                    "Unexpected call: expected exactly 1 call(s) but this is "
+                    "call 2."
+                );
+                CHECK(func.calls().size() == 0);
+
+                func(2);
+                func(2);
+                func(2);
+                func(101);
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+
+        WHEN ("too few calls are made") {
+            func(2);
+            func(3);
+
+            THEN ("the missing calls are reported on destruction") {
+                func.check_called(3);
+                func_ptr.reset();
+                mock_reporter.check_called(
+                    "Expected exactly 1 call(s) but 0 were made."
+                );
+                mock_reporter.check_called(
+                    "Expected exactly 3 call(s) but 1 were made."
+                );
+                mock_reporter.check_called(
+                    "Expected at least 1 call(s) but 0 were made."
+                );
+            }
+        }
+    }
+}
+
+SCENARIO ("Mock_Function expectations execute actions.") {
+    using c2mm::matchers::greater_than;
+    using c2mm::mock::Mock_Function;
+
+    GIVEN ("a Mock_Function with expectations which have actions") {
+        Mock_Function<std::string(int, std::string)> func{};
+        func.on_call(1, std::string{"default"});
+        func.make_expectation(2, std::string{"value"}).returns("two");
+        func.make_expectation(3, std::string{"sequence"})
+            .returns_in_sequence("a", "b");
+        func.make_expectation(4, std::string{"throw"})
+            .throws(std::invalid_argument{"four"});
+        func.make_expectation(greater_than(4), std::string{"move"})
+            .execute([] (int n, std::string&& text) {
+                return std::move(text) + std::to_string(n);
+            });
+
+        THEN ("each call is handled by the action") {
+            CHECK(func(1, std::string{"default"}) == "");
+            CHECK(func(2, std::string{"value"}) == "two");
+            CHECK(func(3, std::string{"sequence"}) == "a");
+            CHECK_THROWS_AS(
+                func(4, std::string{"throw"}),
+                std::invalid_argument
+            );
+            CHECK(func(5, std::string{"move"}) == "move5");
+            CHECK(func.calls().size() == 0);
+        }
+    }
+
+    GIVEN ("an expectation with an action") {
+        Mock_Function<int()> func{};
+        auto handle = func.make_expectation();
+        handle.returns_in_sequence(1, 2, 3);
+
+        WHEN ("the action is replaced") {
+            handle.returns(7);
+
+            THEN ("the new action handles the call") {
+                CHECK(func() == 7);
+            }
+        }
+    }
+}
+
+SCENARIO ("Mock_Function expectations handle a number of calls.") {
+    GIVEN ("a Mock_Function with expectations with cardinalities") {
+        using c2mm::mock::Mock_Function;
+        using Func = Mock_Function<int(int), reporters::Mock_Ref>;
+
+        reporters::Mock mock_reporter{};
+        auto func_ptr = std::make_unique<Func>(std::ref(mock_reporter));
+        auto& func = *func_ptr;
+
+        func.make_expectation(1).times(2).returns(10);
+        func.make_expectation(2).at_least(1).returns(20);
+        func.make_expectation(3).at_most(1).returns(30);
+
+        WHEN ("each is called as often as it allows") {
+            CHECK(func(1) == 10);
+            CHECK(func(1) == 10);
+            for (int i = 0; i < 100; ++i) {
+                CHECK(func(2) == 20);
+            }
+            CHECK(func(3) == 30);
+
+            THEN ("later calls are logged instead") {
+                CHECK(func(1) == 0);
+                CHECK(func(3) == 0);
+                func.check_called(1);
+                func.check_called(3);
+
+                func_ptr.reset();
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+
+        WHEN ("too few calls are made") {
+            CHECK(func(1) == 10);
+
+            THEN ("the missing calls are reported on destruction") {
+                func_ptr.reset();
+                mock_reporter.check_called(
+                    "Expected exactly 2 call(s) but 1 were made."
+                );
+                mock_reporter.check_called(
+                    "Expected at least 1 call(s) but 0 were made."
+                );
+                CHECK(mock_reporter.calls().size() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO ("Mock_Function accepts constexpr matchers as constraints.") {
+    GIVEN ("a Mock_Function with some logged calls") {
+        using c2mm::mock::Mock_Function;
+        Mock_Function<void(int, int)> func{};
+
+        func(1, 2);
+        func(3, 4);
+
+        THEN ("constexpr matchers can match them") {
+            namespace cx = c2mm::matchers::cx;
+            func.check_called(cx::equal_to(1), cx::less_than(3));
+            func.check_all_called(std::vector{
+                std::tuple{cx::greater_than(2), cx::greater_than(2)},
+            });
+        }
+    }
+}
+
+namespace {
+// Counts copies of itself.
+struct Payload {
+    explicit Payload (int* num_copies) : num_copies{num_copies} {}
+    Payload (Payload const& other) : num_copies{other.num_copies} {
+        ++*num_copies;
+    }
+    Payload (Payload&&) = default;
+
+    friend bool operator == (Payload const&, Payload const&) { return true; }
+
+    int* num_copies;
+};
+
+struct Request {
+    int id;
+    std::string body;
+};
+}  // namespace
+
+SCENARIO ("Mock_Function logs what its capture policies keep.") {
+    using c2mm::mock::Mock_Function;
+    namespace capture = c2mm::mock::capture;
+
+    GIVEN ("a Mock_Function which logs arguments by value") {
+        Mock_Function<void(Payload)> func{};
+        int num_copies = 0;
+
+        WHEN ("it is called with an rvalue") {
+            func(Payload{&num_copies});
+
+            THEN ("the argument is moved into the log") {
+                CHECK(num_copies == 0);
+                func.check_called(Payload{&num_copies});
+            }
+        }
+    }
+
+    GIVEN ("a Mock_Function which logs fingerprints of its argument") {
+        Mock_Function<
+            void(std::string),
+            reporters::Fail_Check,
+            c2mm::mock::storage::Heap,
+            c2mm::mock::threading::Single_Threaded,
+            capture::Fingerprint
+        > func{};
+
+        std::string const big(1 << 20, 'x');
+        func(std::string{big});
+        func(std::string{"small"});
+
+        THEN ("each call logs only a digest") {
+            auto const& call = *func.calls().begin();
+            STATIC_CHECK(sizeof(call) == sizeof(capture::Digest));
+            CHECK(std::get<0>(call) == capture::fingerprint(big));
+            func.check_call_count(2);
+        }
+
+        THEN ("calls can be checked against full values") {
+            func.check_all_called(std::vector{
+                std::tuple{std::string{"small"}},
+                std::tuple{big},
+            });
+        }
+    }
+
+    GIVEN ("a Mock_Function with a different policy per parameter") {
+        Mock_Function<
+            void(Request, std::string, int),
+            reporters::Fail_Check,
+            c2mm::mock::storage::Heap,
+            c2mm::mock::threading::Single_Threaded,
+            capture::Per_Parameter<
+                capture::Project<&Request::id>,
+                capture::Project<[] (std::string const& text) {
+                    return text.size();
+                }>,
+                capture::Drop
+            >
+        > func{};
+
+        func(Request{7, "payload"}, std::string{"hello"}, 3);
+
+        THEN ("only the projections are logged") {
+            using Logged = std::tuple<int, std::size_t, capture::Dropped>;
+            CHECK(*func.calls().begin() == Logged{7, 5, capture::dropped});
+            func.check_call_count(1);
+        }
+
+        THEN ("constraints apply to the projections") {
+            using c2mm::matchers::greater_than;
+            func.check_called(7, greater_than(4u), capture::dropped);
+        }
+
+        THEN ("full values are projected before they are compared") {
+            func.check_called(
+                Request{7, "other"},
+                std::string{"world"},
+                capture::dropped
+            );
+        }
+    }
+}
+
+SCENARIO ("Mock_Function allocates from a given memory resource.") {
+    using c2mm::matchers::greater_than;
+    using c2mm::mock::Mock_Function;
+
+    // Anything not allocated from the arena would fall back to the default
+    // resource, which now refuses every allocation.
+    struct Default_Resource_Guard {
+        std::pmr::memory_resource* previous = std::pmr::set_default_resource(
+            std::pmr::null_memory_resource()
+        );
+        ~Default_Resource_Guard () {
+            std::pmr::set_default_resource(previous);
+        }
+    };
+
+    std::vector<std::byte> buffer(1 << 16);
+    std::pmr::monotonic_buffer_resource arena{
+        buffer.data(),
+        buffer.size(),
+        std::pmr::null_memory_resource()
+    };
+    auto const in_arena = [&buffer] (void const* ptr) {
+        auto const* address = static_cast<std::byte const*>(ptr);
+        return address >= buffer.data() and
+            address < buffer.data() + buffer.size();
+    };
+
+    GIVEN ("a Mock_Function constructed with an arena") {
+        Default_Resource_Guard const guard{};
+        Mock_Function<int(int, std::string)> func{&arena};
+
+        WHEN ("it has expectations and is called") {
+            func.expect_call(1, std::string{"one"});
+            func.make_expectation(greater_than(1), std::string{"two"});
+            func(1, std::string{"one"});
+            func(2, std::string{"two"});
+            func(3, std::string{"three"});
+
+            THEN ("logged calls live in the arena") {
+                CHECK(in_arena(&*func.calls().begin()));
+                func.check_called(3, std::string{"three"});
+            }
+        }
+    }
+
+    GIVEN ("a multi-threaded Mock_Function constructed with an arena") {
+        Default_Resource_Guard const guard{};
+        Mock_Function<
+            void(int),
+            reporters::Fail_Check,
+            c2mm::mock::storage::Chunked<>,
+            c2mm::mock::threading::Multi_Threaded<>
+        > func{&arena};
+
+        WHEN ("it is called") {
+            func(1);
+            func(2);
+
+            THEN ("logged calls live in the arena") {
+                CHECK(in_arena(&*func.calls().begin()));
+                func.check_all_called(std::vector{
+                    std::tuple{1},
+                    std::tuple{2},
+                });
+            }
+        }
+    }
+}
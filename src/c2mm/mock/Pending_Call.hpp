@@ -0,0 +1,193 @@
+#ifndef C2MM__MOCK__PENDING_CALL_HPP_
+#define C2MM__MOCK__PENDING_CALL_HPP_
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace c2mm::mock {
+/**
+ * Resumes a coroutine whose call has completed, e.g. by queueing it to run
+ * later. An empty @c Executor resumes the coroutine inline, from within the
+ * function which completed the call.
+ */
+using Executor = std::function<void(std::coroutine_handle<>)>;
+
+namespace impl_ {
+/**
+ * Shared state of a call whose result is awaited.
+ */
+template <typename T_Result>
+struct Async_State {
+    using Value = std::conditional_t<
+        std::is_void_v<T_Result>,
+        std::monostate,
+        T_Result
+    >;
+
+    bool is_done () const { return value.has_value() or error != nullptr; }
+
+    template <typename... T_Args>
+    void set_value (T_Args&&... args) {
+        require_pending();
+        value.emplace(std::forward<T_Args>(args)...);
+        resume_waiter();
+    }
+
+    void set_error (std::exception_ptr exception) {
+        require_pending();
+        error = std::move(exception);
+        resume_waiter();
+    }
+
+    void require_pending () const {
+        if (is_done()) {
+            throw std::logic_error{"Pending call is already complete."};
+        }
+    }
+
+    void resume_waiter () {
+        if (auto const resume = std::exchange(waiter, nullptr)) {
+            if (executor) {
+                executor(resume);
+            } else {
+                resume.resume();
+            }
+        }
+    }
+
+    Executor executor;
+    std::optional<Value> value{};
+    std::exception_ptr error{};
+    std::coroutine_handle<> waiter{};
+};
+}  // namespace impl_
+
+/**
+ * The result of a call to an @c Async_Mock_Function, to be @c co_await ed by
+ * the caller.
+ *
+ * Awaiting suspends the caller until the call is completed through its @c
+ * Pending_Call. If the call has an executor, the caller is always resumed by
+ * it, even if the call was already complete. Otherwise, awaiting a call which
+ * is already complete does not suspend.
+ * The result of the @c co_await expression is the value the call was
+ * completed with, or else the exception it was failed with is rethrown.
+ *
+ * @tparam T_Result The type of the result of the @c co_await expression.
+ */
+template <typename T_Result>
+class Async_Result {
+  public:
+    explicit Async_Result (std::shared_ptr<impl_::Async_State<T_Result>> state)
+          : state_{std::move(state)} {}
+
+    Async_Result (Async_Result&&) = default;
+    Async_Result& operator = (Async_Result&&) = default;
+
+    bool await_ready () const noexcept {
+        return state_->is_done() and not state_->executor;
+    }
+
+    void await_suspend (std::coroutine_handle<> waiter) {
+        if (state_->is_done()) {
+            state_->executor(waiter);
+        } else {
+            state_->waiter = waiter;
+        }
+    }
+
+    T_Result await_resume () {
+        if (state_->error) {
+            std::rethrow_exception(state_->error);
+        }
+        if constexpr (not std::is_void_v<T_Result>) {
+            return std::move(*state_->value);
+        }
+    }
+
+  private:
+    std::shared_ptr<impl_::Async_State<T_Result>> state_;
+};
+
+/**
+ * A call to an @c Async_Mock_Function which has not been completed yet.
+ *
+ * Completing the call resumes the coroutine awaiting its @c Async_Result, if
+ * any, with the executor of the mock. A call is completed at most once.
+ * Copies refer to the same call.
+ *
+ * A call must be completed on the thread which awaits it, or the two must be
+ * otherwise synchronized.
+ *
+ * @tparam T_Result The type of the result of the call.
+ */
+template <typename T_Result>
+class Pending_Call {
+  public:
+    using Value = typename impl_::Async_State<T_Result>::Value;
+
+    /**
+     * Begin a call whose awaiting coroutine is resumed with @p executor.
+     */
+    explicit Pending_Call (Executor executor = {})
+          : state_{std::make_shared<impl_::Async_State<T_Result>>()} {
+        state_->executor = std::move(executor);
+    }
+
+    /**
+     * The awaitable to return to the caller.
+     */
+    Async_Result<T_Result> result () const {
+        return Async_Result<T_Result>{state_};
+    }
+
+    /**
+     * Indicates whether the call was completed or failed.
+     */
+    bool is_done () const { return state_->is_done(); }
+
+    /**
+     * Indicates whether a coroutine is suspended awaiting the call.
+     */
+    bool is_awaited () const { return state_->waiter != nullptr; }
+
+    /**
+     * Complete the call with a value constructed from @p args, which is empty
+     * for @c void results.
+     *
+     * @throws std::logic_error If the call is already complete.
+     */
+    template <typename... T_Args>
+        requires std::is_constructible_v<Value, T_Args...>
+    void complete (T_Args&&... args) {
+        state_->set_value(std::forward<T_Args>(args)...);
+    }
+
+    /**
+     * Complete the call by rethrowing @p error in the caller.
+     *
+     * @param[in] error The exception to rethrow. Must not be null.
+     *
+     * @throws std::invalid_argument If @p error is null.
+     * @throws std::logic_error If the call is already complete.
+     */
+    void fail (std::exception_ptr error) {
+        if (not error) {
+            throw std::invalid_argument{"Cannot fail a call with no error."};
+        }
+        state_->set_error(std::move(error));
+    }
+
+  private:
+    std::shared_ptr<impl_::Async_State<T_Result>> state_;
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__PENDING_CALL_HPP_
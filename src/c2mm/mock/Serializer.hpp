@@ -0,0 +1,168 @@
+#ifndef C2MM__MOCK__SERIALIZER_HPP_
+#define C2MM__MOCK__SERIALIZER_HPP_
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace c2mm::mock {
+/**
+ * Customization point which converts values of type @p T to and from a
+ * compact binary form, for storage outside of the process' heap.
+ *
+ * A specialization provides:
+ *  - `static std::size_t size (T const& value)`, the number of bytes @c write
+ *    will produce for @p value.
+ *  - `static void write (T const& value, std::byte* out)`, which writes
+ *    exactly `size(value)` bytes to @p out.
+ *  - `static T read (std::byte const* in, std::size_t size)`, which
+ *    reconstructs a value from the @p size bytes @c write produced.
+ *
+ * @p out and @p in need not be aligned.
+ *
+ * Specializations are provided for trivially copyable types, for @c
+ * std::basic_string of trivially copyable characters and for @c std::tuple of
+ * serializable types. Specialize this for other types.
+ *
+ * @tparam T The type to serialize.
+ */
+template <typename T>
+struct Serializer;
+
+/**
+ * Types for which @c Serializer is specialized.
+ */
+template <typename T>
+concept Serializable = requires (
+    T const& value,
+    std::byte* out,
+    std::byte const* in,
+    std::size_t size
+) {
+    { Serializer<T>::size(value) } -> std::same_as<std::size_t>;
+    Serializer<T>::write(value, out);
+    { Serializer<T>::read(in, size) } -> std::same_as<T>;
+};
+
+/**
+ * Serializes trivially copyable types as their object representation.
+ */
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+struct Serializer<T> {
+    static std::size_t size (T const&) { return sizeof(T); }
+
+    static void write (T const& value, std::byte* out) {
+        std::memcpy(out, &value, sizeof(T));
+    }
+
+    static T read (std::byte const* in, std::size_t) {
+        std::array<std::byte, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), in, sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+};
+
+/**
+ * Serializes strings as their characters, without a terminator.
+ */
+template <typename T_Char, typename T_Traits, typename T_Alloc>
+    requires std::is_trivially_copyable_v<T_Char>
+struct Serializer<std::basic_string<T_Char, T_Traits, T_Alloc>> {
+    using String = std::basic_string<T_Char, T_Traits, T_Alloc>;
+
+    static std::size_t size (String const& value) {
+        return value.size() * sizeof(T_Char);
+    }
+
+    static void write (String const& value, std::byte* out) {
+        if (not value.empty()) {
+            std::memcpy(out, value.data(), size(value));
+        }
+    }
+
+    static String read (std::byte const* in, std::size_t size) {
+        String value(size / sizeof(T_Char), T_Char{});
+        std::memcpy(value.data(), in, size);
+        return value;
+    }
+};
+
+/**
+ * Serializes each element of a tuple in turn, each preceded by its size.
+ *
+ * Each element's size is stored in 32 bits, so @c size throws @c
+ * std::length_error for an element of 4 GiB or more.
+ */
+template <typename... T_Elements>
+    requires (Serializable<T_Elements> and ...)
+struct Serializer<std::tuple<T_Elements...>> {
+    using Tuple = std::tuple<T_Elements...>;
+    using Length = std::uint32_t;
+
+    static std::size_t size (Tuple const& value) {
+        return std::apply(
+            [] (auto const&... elements) {
+                return (
+                    std::size_t{0} + ... +
+                    (sizeof(Length) + element_size(elements))
+                );
+            },
+            value
+        );
+    }
+
+    static void write (Tuple const& value, std::byte* out) {
+        std::apply(
+            [&out] (auto const&... elements) {
+                (write_element(elements, out), ...);
+            },
+            value
+        );
+    }
+
+    static Tuple read (std::byte const* in, std::size_t) {
+        // Braced initialization reads the elements in order.
+        return Tuple{read_element<T_Elements>(in)...};
+    }
+
+  private:
+    template <typename T_Element>
+    static std::size_t element_size (T_Element const& element) {
+        auto const size = Serializer<T_Element>::size(element);
+        if (size > std::numeric_limits<Length>::max()) {
+            throw std::length_error{"serialized tuple element is too large"};
+        }
+        return size;
+    }
+
+    template <typename T_Element>
+    static void write_element (T_Element const& element, std::byte*& out) {
+        auto const length = static_cast<Length>(element_size(element));
+        std::memcpy(out, &length, sizeof(Length));
+        out += sizeof(Length);
+        Serializer<T_Element>::write(element, out);
+        out += length;
+    }
+
+    template <typename T_Element>
+    static T_Element read_element (std::byte const*& in) {
+        Length length;
+        std::memcpy(&length, in, sizeof(Length));
+        in += sizeof(Length);
+        auto element = Serializer<T_Element>::read(in, length);
+        in += length;
+        return element;
+    }
+};
+}  // namespace c2mm::mock
+
+#endif  // C2MM__MOCK__SERIALIZER_HPP_
@@ -0,0 +1,77 @@
+#include "c2mm/mock/Serializer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+template <typename T>
+T round_trip (T const& value) {
+    using c2mm::mock::Serializer;
+
+    std::vector<std::byte> bytes(Serializer<T>::size(value) + 1);
+    // Deliberately misaligned.
+    Serializer<T>::write(value, bytes.data() + 1);
+    return Serializer<T>::read(bytes.data() + 1, bytes.size() - 1);
+}
+
+struct Point {
+    int x;
+    double y;
+
+    friend bool operator == (Point const&, Point const&) = default;
+};
+
+// Claims to serialize to more bytes than a tuple can record.
+struct Huge {};
+}  // namespace
+
+template <>
+struct c2mm::mock::Serializer<Huge> {
+    static std::size_t size (Huge const&) { return std::size_t{5} << 30; }
+    static void write (Huge const&, std::byte*) {}
+    static Huge read (std::byte const*, std::size_t) { return {}; }
+};
+
+TEST_CASE ("c2mm::mock::Serializer") {
+    using c2mm::mock::Serializable;
+    using c2mm::mock::Serializer;
+
+    SECTION ("trivially copyable types are copied bytewise") {
+        CHECK(Serializer<Point>::size(Point{}) == sizeof(Point));
+        CHECK(round_trip(Point{3, 4.5}) == Point{3, 4.5});
+        CHECK(round_trip(7) == 7);
+    }
+
+    SECTION ("strings store only their characters") {
+        CHECK(Serializer<std::string>::size("hello") == 5);
+        CHECK(round_trip(std::string{"hello"}) == "hello");
+        CHECK(round_trip(std::string{}).empty());
+    }
+
+    SECTION ("tuples store each element with its size") {
+        using Tuple = std::tuple<int, std::string, Point>;
+        Tuple const value{1, "two", {3, 4.0}};
+        CHECK(Serializer<Tuple>::size(value) ==
+            3 * sizeof(std::uint32_t) + sizeof(int) + 3 + sizeof(Point));
+        CHECK(round_trip(value) == value);
+    }
+
+    SECTION ("tuple elements of 4 GiB or more are rejected") {
+        using Tuple = std::tuple<int, Huge>;
+        CHECK_THROWS_AS(
+            Serializer<Tuple>::size(Tuple{1, Huge{}}),
+            std::length_error
+        );
+    }
+
+    SECTION ("other types must provide a serializer") {
+        STATIC_CHECK(not Serializable<std::vector<int>>);
+        STATIC_CHECK(not Serializable<std::tuple<int, std::vector<int>>>);
+    }
+}
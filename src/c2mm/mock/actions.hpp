@@ -0,0 +1,85 @@
+#ifndef C2MM__MOCK__ACTIONS_HPP_
+#define C2MM__MOCK__ACTIONS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace c2mm::mock::actions {
+/**
+ * Action which returns a copy of the same value from every call. All
+ * arguments are ignored.
+ *
+ * @tparam T_Value The type of the stored value. Must convert to the return
+ *     type of the mocked function.
+ */
+template <typename T_Value>
+struct Return {
+    template <typename... T_Args>
+    T_Value& operator () (T_Args&&...) {
+        return value;
+    }
+
+    T_Value value;
+};
+
+/**
+ * Action which returns each of several values in turn, one per call. Once
+ * every value has been returned, the last one is returned from every later
+ * call. All arguments are ignored.
+ *
+ * Concurrent calls each take a different value, until the last.
+ *
+ * @tparam T_Value The type of the stored values. Must convert to the return
+ *     type of the mocked function.
+ */
+template <typename T_Value>
+class Return_Sequence {
+  public:
+    /**
+     * @param[in] values The values to return, in order. Must not be empty.
+     */
+    explicit Return_Sequence (std::vector<T_Value> values)
+          : values_{std::move(values)} {}
+
+    Return_Sequence (Return_Sequence&& other)
+          : values_{std::move(other.values_)},
+            next_{other.next_.load(std::memory_order_relaxed)} {}
+
+    template <typename... T_Args>
+    T_Value& operator () (T_Args&&...) {
+        auto const last = values_.size() - 1;
+        auto idx = next_.load(std::memory_order_relaxed);
+        // Once the last value is reached, calls only read the index.
+        if (idx < last) {
+            idx = next_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return values_[std::min(idx, last)];
+    }
+
+  private:
+    std::vector<T_Value> values_;
+    std::atomic<std::size_t> next_{0};
+};
+
+/**
+ * Action which throws a copy of the same exception from every call. All
+ * arguments are ignored.
+ *
+ * @tparam T_Return The return type of the mocked function.
+ * @tparam T_Exception The type of the exception.
+ */
+template <typename T_Return, typename T_Exception>
+struct Throw {
+    template <typename... T_Args>
+    [[noreturn]] T_Return operator () (T_Args&&...) const {
+        throw exception;
+    }
+
+    T_Exception exception;
+};
+}  // namespace c2mm::mock::actions
+
+#endif  // C2MM__MOCK__ACTIONS_HPP_
@@ -45,6 +45,21 @@ template <typename... T_Args>
 Bound_Args<T_Args...> bind_args (T_Args&&... args) {
     return {args...};
 }
+
+/**
+ * Type trait mapping a @c Captured_Args type to the @c Bound_Args type for the
+ * same arguments.
+ */
+template <typename T_Captured>
+struct bound_args_for;
+
+template <typename... T_Args>
+struct bound_args_for<std::tuple<T_Args...>> {
+    using type = Bound_Args<T_Args...>;
+};
+
+template <typename T_Captured>
+using bound_args_for_t = typename bound_args_for<T_Captured>::type;
 }  // namespace c2mm::mock
 
 #endif  // C2MOCK__MOCK__ARGS_HPP_
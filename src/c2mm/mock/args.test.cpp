@@ -39,3 +39,14 @@ SCENARIO ("Arguments can be captured and bound", "[unit]") {
         }
     }
 }
+
+TEST_CASE ("Bound_Args can be derived from Captured_Args", "[unit]") {
+    using c2mm::mock::Bound_Args;
+    using c2mm::mock::Captured_Args;
+    using c2mm::mock::bound_args_for_t;
+
+    STATIC_CHECK((std::is_same_v<
+        bound_args_for_t<Captured_Args<int const&, double&&>>,
+        Bound_Args<int, double>
+    >));
+}
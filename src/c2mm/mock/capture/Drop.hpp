@@ -0,0 +1,54 @@
+#ifndef C2MM__MOCK__CAPTURE__DROP_HPP_
+#define C2MM__MOCK__CAPTURE__DROP_HPP_
+
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/Match_Cost.hpp"
+
+namespace c2mm::mock::capture {
+/**
+ * What is logged in place of a dropped argument. All instances are equal.
+ */
+struct Dropped {
+    friend constexpr bool operator == (Dropped, Dropped) = default;
+};
+
+/**
+ * The constraint to give for a dropped argument when checking calls.
+ */
+inline constexpr Dropped dropped{};
+
+/**
+ * A capture policy which does not log the argument at all.
+ *
+ * Logged calls hold an empty @c Dropped instead, so the argument costs neither
+ * a copy nor memory. The only constraint accepted for it is @c dropped (or a
+ * matcher accepting a @c Dropped).
+ */
+struct Drop {
+    template <typename T>
+    using Stored = Dropped;
+
+    template <typename T, typename T_Arg>
+    static Dropped capture (T_Arg&&) {
+        return {};
+    }
+
+    template <typename T, typename T_Constraint>
+    static T_Constraint&& constraint (T_Constraint&& constraint) {
+        return std::forward<T_Constraint>(constraint);
+    }
+};
+}  // namespace c2mm::mock::capture
+
+namespace c2mm::matchers {
+/**
+ * Comparing dropped arguments costs nothing.
+ */
+template <>
+struct Match_Cost<mock::capture::Dropped>
+      : std::integral_constant<unsigned, 0> {};
+}  // namespace c2mm::matchers
+
+#endif  // C2MM__MOCK__CAPTURE__DROP_HPP_
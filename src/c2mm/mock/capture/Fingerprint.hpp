@@ -0,0 +1,188 @@
+#ifndef C2MM__MOCK__CAPTURE__FINGERPRINT_HPP_
+#define C2MM__MOCK__CAPTURE__FINGERPRINT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/Match_Cost.hpp"
+#include "c2mm/matchers/utils.hpp"
+
+namespace c2mm::mock::capture {
+/**
+ * A 64-bit hash of the content of a value.
+ */
+struct Digest {
+    std::uint64_t value;
+
+    friend constexpr bool operator == (Digest, Digest) = default;
+};
+
+namespace impl_ {
+inline constexpr std::uint64_t prime_1 = 0x9e3779b185ebca87;
+inline constexpr std::uint64_t prime_2 = 0xc2b2ae3d27d4eb4f;
+inline constexpr std::uint64_t prime_3 = 0x165667b19e3779f9;
+inline constexpr std::uint64_t prime_4 = 0x85ebca77c2b2ae63;
+inline constexpr std::uint64_t prime_5 = 0x27d4eb2f165667c5;
+
+inline std::uint64_t rotl (std::uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline std::uint64_t load_64 (unsigned char const* bytes) {
+    std::uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+inline std::uint64_t round (std::uint64_t acc, std::uint64_t word) {
+    return rotl(acc + word * prime_2, 31) * prime_1;
+}
+
+/**
+ * Hash @p size bytes at @p data, in the style of XXH64. Four independent
+ * lanes consume 32 bytes per iteration, so large payloads hash at close to
+ * memory bandwidth.
+ */
+inline std::uint64_t hash_bytes (void const* data, std::size_t size) {
+    auto const* bytes = static_cast<unsigned char const*>(data);
+    auto const* const end = bytes + size;
+    std::uint64_t hash;
+
+    if (size >= 32) {
+        std::uint64_t lane_0 = prime_1 + prime_2;
+        std::uint64_t lane_1 = prime_2;
+        std::uint64_t lane_2 = 0;
+        std::uint64_t lane_3 = 0 - prime_1;
+        for (; end - bytes >= 32; bytes += 32) {
+            lane_0 = round(lane_0, load_64(bytes));
+            lane_1 = round(lane_1, load_64(bytes + 8));
+            lane_2 = round(lane_2, load_64(bytes + 16));
+            lane_3 = round(lane_3, load_64(bytes + 24));
+        }
+        hash = rotl(lane_0, 1) + rotl(lane_1, 7) + rotl(lane_2, 12) +
+            rotl(lane_3, 18);
+    } else {
+        hash = prime_5;
+    }
+
+    hash += size;
+    for (; end - bytes >= 8; bytes += 8) {
+        hash ^= round(0, load_64(bytes));
+        hash = rotl(hash, 27) * prime_1 + prime_4;
+    }
+    for (; bytes < end; ++bytes) {
+        hash ^= *bytes * prime_5;
+        hash = rotl(hash, 11) * prime_1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime_2;
+    hash ^= hash >> 29;
+    hash *= prime_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// Floating point values are excluded: equal values such as 0.0 and -0.0 may
+// have different bytes.
+template <typename T>
+concept Byte_Hashable =
+    std::is_integral_v<T> or std::has_unique_object_representations_v<T>;
+
+template <typename T>
+concept Byte_Range =
+    std::ranges::contiguous_range<T const> and
+    std::ranges::sized_range<T const> and
+    Byte_Hashable<std::ranges::range_value_t<T const>>;
+
+/**
+ * Hash the content of @p value. Contiguous ranges of integral values (e.g.
+ * strings and vectors of integers) hash their bytes. Other ranges combine the
+ * hashes of their elements. Floating point zeros are hashed as positive zero,
+ * so equal values have equal hashes. Anything else uses @c std::hash.
+ */
+template <typename T>
+std::uint64_t hash_content (T const& value) {
+    if constexpr (Byte_Range<T>) {
+        return hash_bytes(
+            std::ranges::data(value),
+            std::ranges::size(value) *
+                sizeof(std::ranges::range_value_t<T const>)
+        );
+    } else if constexpr (std::ranges::input_range<T const>) {
+        std::uint64_t hash = prime_5;
+        for (auto const& element : value) {
+            hash = round(hash, hash_content(element));
+        }
+        return hash;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return std::hash<T>{}(value == T{} ? T{} : value);
+    } else {
+        static_assert(
+            requires { std::hash<T>{}(value); },
+            "Fingerprinted arguments must be ranges or have a std::hash."
+        );
+        return std::hash<T>{}(value);
+    }
+}
+}  // namespace impl_
+
+/**
+ * Compute the @c Digest of @p value.
+ * @param[in] value The value to hash.
+ * @return The digest of the content of @p value.
+ */
+template <typename T>
+Digest fingerprint (T const& value) {
+    return {impl_::hash_content(value)};
+}
+
+/**
+ * A capture policy which logs only a 64-bit @c Digest of the argument's
+ * content.
+ *
+ * Logged calls hold 8 bytes however large the argument is. Constraints must
+ * be exact values, which are hashed once when the check is made. Matching a
+ * call then compares digests, so unequal values may very rarely match.
+ * Matchers cannot be applied to a digest.
+ */
+struct Fingerprint {
+    template <typename T>
+    using Stored = Digest;
+
+    template <typename T, typename T_Arg>
+    static Digest capture (T_Arg const& arg) {
+        return fingerprint(arg);
+    }
+
+    template <typename T, typename T_Constraint>
+    static Digest constraint (T_Constraint const& constraint) {
+        static_assert(
+            not matchers::utils::is_matcher_v<T_Constraint>,
+            "Fingerprinted arguments can only be compared to exact values."
+        );
+
+        if constexpr (std::is_same_v<T_Constraint, T>) {
+            return fingerprint(constraint);
+        } else {
+            return fingerprint(T(constraint));
+        }
+    }
+};
+}  // namespace c2mm::mock::capture
+
+namespace c2mm::matchers {
+/**
+ * Comparing digests costs the same as comparing integers.
+ */
+template <>
+struct Match_Cost<mock::capture::Digest>
+      : std::integral_constant<unsigned, 1> {};
+}  // namespace c2mm::matchers
+
+#endif  // C2MM__MOCK__CAPTURE__FINGERPRINT_HPP_
@@ -0,0 +1,49 @@
+#include "c2mm/mock/capture/Fingerprint.hpp"
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE ("c2mm::mock::capture::fingerprint") {
+    using c2mm::mock::capture::fingerprint;
+
+    SECTION ("equal contents have equal digests") {
+        CHECK(fingerprint(std::string{"abc"}) ==
+            fingerprint(std::string_view{"abc"}));
+        CHECK(fingerprint(std::vector{1, 2, 3}) ==
+            fingerprint(std::vector{1, 2, 3}));
+        CHECK(fingerprint(std::list<std::string>{"a", "b"}) ==
+            fingerprint(std::vector<std::string>{"a", "b"}));
+        CHECK(fingerprint(42) == fingerprint(42));
+    }
+
+    SECTION ("equal floating point values have equal digests") {
+        CHECK(fingerprint(std::vector{0.0f, 1.5f}) ==
+            fingerprint(std::vector{-0.0f, 1.5f}));
+        CHECK(fingerprint(-0.0) == fingerprint(0.0));
+        CHECK(fingerprint(std::vector{1.0, 2.0}) !=
+            fingerprint(std::vector{2.0, 1.0}));
+    }
+
+    SECTION ("a change at any position changes the digest") {
+        std::string const text(100, 'x');
+        auto const digest = fingerprint(text);
+        for (std::size_t idx = 0; idx < text.size(); ++idx) {
+            auto changed = text;
+            changed[idx] = 'y';
+            CAPTURE(idx);
+            CHECK(fingerprint(changed) != digest);
+        }
+    }
+
+    SECTION ("the length is part of the digest") {
+        CHECK(fingerprint(std::string(8, '\0')) !=
+            fingerprint(std::string(9, '\0')));
+        CHECK(fingerprint(std::vector<std::string>{"ab", "c"}) !=
+            fingerprint(std::vector<std::string>{"a", "bc"}));
+    }
+}
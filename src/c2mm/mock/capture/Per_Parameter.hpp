@@ -0,0 +1,134 @@
+#ifndef C2MM__MOCK__CAPTURE__PER_PARAMETER_HPP_
+#define C2MM__MOCK__CAPTURE__PER_PARAMETER_HPP_
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/mock/capture/Value.hpp"
+
+namespace c2mm::mock::capture {
+/**
+ * A capture policy which applies a different policy to each parameter.
+ *
+ * @tparam T_Policies One capture policy per parameter of the mocked function,
+ *     e.g. `Per_Parameter<Value, Fingerprint, Drop>`.
+ */
+template <typename... T_Policies>
+struct Per_Parameter {};
+
+/**
+ * Type trait selecting the capture policy for the parameter at @p t_idx. A
+ * policy other than @c Per_Parameter applies to every parameter.
+ */
+template <typename T_Capture, std::size_t t_idx>
+struct policy_for {
+    using type = T_Capture;
+};
+
+template <typename... T_Policies, std::size_t t_idx>
+struct policy_for<Per_Parameter<T_Policies...>, t_idx> {
+    using type = std::tuple_element_t<t_idx, std::tuple<T_Policies...>>;
+};
+
+template <typename T_Capture, std::size_t t_idx>
+using policy_for_t = typename policy_for<T_Capture, t_idx>::type;
+
+namespace impl_ {
+template <typename T_Capture, std::size_t t_num_parameters>
+struct applies_to : std::true_type {};
+
+template <typename... T_Policies, std::size_t t_num_parameters>
+struct applies_to<Per_Parameter<T_Policies...>, t_num_parameters>
+      : std::bool_constant<sizeof...(T_Policies) == t_num_parameters> {};
+}  // namespace impl_
+
+/**
+ * Applies a capture policy to the arguments of a function with parameters of
+ * types @p T_Parameters.
+ *
+ * @tparam T_Capture The capture policy, either one policy for every
+ *     parameter or a @c Per_Parameter.
+ * @tparam T_Parameters Types of the function's parameters.
+ */
+template <typename T_Capture, typename... T_Parameters>
+class Arg_Capture {
+    static_assert(
+        impl_::applies_to<T_Capture, sizeof...(T_Parameters)>::value,
+        "Per_Parameter needs exactly one capture policy per parameter."
+    );
+
+    template <std::size_t t_idx>
+    using Param = std::remove_cvref_t<
+        std::tuple_element_t<t_idx, std::tuple<T_Parameters...>>
+    >;
+
+    template <std::size_t t_idx>
+    using Policy = policy_for_t<T_Capture, t_idx>;
+
+    template <std::size_t... t_idxs>
+    static auto captured_type (std::index_sequence<t_idxs...>)
+        -> std::tuple<
+            typename Policy<t_idxs>::template Stored<Param<t_idxs>>...
+        >;
+
+    template <std::size_t... t_idxs>
+    static constexpr bool all_values (std::index_sequence<t_idxs...>) {
+        return (std::is_same_v<Policy<t_idxs>, Value> and ...);
+    }
+
+    using Indices = std::index_sequence_for<T_Parameters...>;
+
+  public:
+    /**
+     * @c std::tuple of what is logged for each argument.
+     */
+    using Captured = decltype(captured_type(Indices{}));
+
+    /**
+     * Whether every argument is logged as is.
+     */
+    static constexpr bool captures_values = all_values(Indices{});
+
+    /**
+     * Log a call with @p log, capturing each argument per its policy.
+     * @param[out] log The @c Call_Log of @c Captured tuples.
+     * @param[in] args The arguments of the call.
+     */
+    template <typename T_Log, typename... T_Args>
+    static void log (T_Log& log, T_Args&&... args) {
+        [&] <std::size_t... t_idxs> (std::index_sequence<t_idxs...>) {
+            log.log(Policy<t_idxs>::template capture<Param<t_idxs>>(
+                std::forward<T_Args>(args)
+            )...);
+        }(Indices{});
+    }
+
+    /**
+     * Adapt constraints on the arguments to constraints on what is logged.
+     *
+     * Constraints which a policy leaves unchanged are forwarded as references,
+     * others are returned by value.
+     *
+     * @param[in] constraints One constraint per parameter.
+     * @return A @c std::tuple of the adapted constraints.
+     */
+    template <typename... T_Constraints>
+    static auto constraints (T_Constraints&&... constraints) {
+        return [&] <std::size_t... t_idxs> (std::index_sequence<t_idxs...>) {
+            return std::tuple<decltype(
+                Policy<t_idxs>::template constraint<Param<t_idxs>>(
+                    std::forward<T_Constraints>(constraints)
+                )
+            )...>{
+                Policy<t_idxs>::template constraint<Param<t_idxs>>(
+                    std::forward<T_Constraints>(constraints)
+                )...
+            };
+        }(std::index_sequence_for<T_Constraints...>{});
+    }
+};
+}  // namespace c2mm::mock::capture
+
+#endif  // C2MM__MOCK__CAPTURE__PER_PARAMETER_HPP_
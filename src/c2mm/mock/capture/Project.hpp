@@ -0,0 +1,51 @@
+#ifndef C2MM__MOCK__CAPTURE__PROJECT_HPP_
+#define C2MM__MOCK__CAPTURE__PROJECT_HPP_
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "c2mm/matchers/utils.hpp"
+
+namespace c2mm::mock::capture {
+/**
+ * A capture policy which logs only a projection of the argument, e.g. its
+ * size or an identifier.
+ *
+ * Constraints are matched against the projection. As a convenience, a value
+ * of the parameter's own type is projected before it is compared, so a call
+ * can still be checked against a full argument.
+ *
+ * @tparam t_projection Pointer to data member, or captureless callable, taking
+ *     the argument. For example, `&Request::id` or
+ *     `[] (std::string const& s) { return s.size(); }`.
+ */
+template <auto t_projection>
+struct Project {
+    template <typename T>
+    using Stored = std::remove_cvref_t<
+        std::invoke_result_t<decltype(t_projection), T const&>
+    >;
+
+    template <typename T, typename T_Arg>
+    static Stored<T> capture (T_Arg&& arg) {
+        return std::invoke(t_projection, std::forward<T_Arg>(arg));
+    }
+
+    template <typename T, typename T_Constraint>
+    static decltype(auto) constraint (T_Constraint&& constraint) {
+        using Constraint = std::remove_cvref_t<T_Constraint>;
+
+        if constexpr (
+            std::is_same_v<Constraint, T> and
+            not matchers::utils::is_matcher_v<Constraint>
+        ) {
+            return Stored<T>{std::invoke(t_projection, constraint)};
+        } else {
+            return std::forward<T_Constraint>(constraint);
+        }
+    }
+};
+}  // namespace c2mm::mock::capture
+
+#endif  // C2MM__MOCK__CAPTURE__PROJECT_HPP_
@@ -0,0 +1,43 @@
+#ifndef C2MM__MOCK__CAPTURE__VALUE_HPP_
+#define C2MM__MOCK__CAPTURE__VALUE_HPP_
+
+#include <utility>
+
+namespace c2mm::mock::capture {
+/**
+ * A capture policy which logs the argument itself.
+ *
+ * This is the default policy. The argument is moved into the log when the
+ * caller passed an rvalue, e.g. to a parameter taken by value, and copied
+ * otherwise. Constraints are matched against the argument as is.
+ */
+struct Value {
+    /**
+     * Type logged for a parameter of type @p T, without cv-ref qualifiers.
+     */
+    template <typename T>
+    using Stored = T;
+
+    /**
+     * Forward @p arg to be logged.
+     * @param[in] arg The argument of the call.
+     * @return @p arg, forwarded.
+     */
+    template <typename T, typename T_Arg>
+    static T_Arg&& capture (T_Arg&& arg) {
+        return std::forward<T_Arg>(arg);
+    }
+
+    /**
+     * Adapt a constraint on the argument to a constraint on what is logged.
+     * @param[in] constraint The constraint, forwarded unchanged.
+     * @return @p constraint, forwarded.
+     */
+    template <typename T, typename T_Constraint>
+    static T_Constraint&& constraint (T_Constraint&& constraint) {
+        return std::forward<T_Constraint>(constraint);
+    }
+};
+}  // namespace c2mm::mock::capture
+
+#endif  // C2MM__MOCK__CAPTURE__VALUE_HPP_
@@ -3,9 +3,27 @@
 
 #include <string_view>
 
+#ifndef C2MM_NO_CATCH2
 #include <catch2/catch_test_macros.hpp>
+#endif
 
 namespace c2mm::mock::reporters {
+#ifdef C2MM_NO_CATCH2
+/**
+ * Stand-in used when @c C2MM_NO_CATCH2 is defined, where there is no @c
+ * FAIL macro to delegate to. Mocks may still name it, but reporting a
+ * failure with it does not compile. Use a reporter such as @c Throws instead.
+ */
+struct Fail {
+    template <typename T_Message>
+    void operator () (T_Message const&) const {
+        static_assert(
+            sizeof(T_Message) == 0,
+            "reporters::Fail requires Catch2; use another reporter."
+        );
+    }
+};
+#else
 /**
  * A reporter policy which delegates to Catch2's @c FAIL macro.
  */
@@ -18,6 +36,7 @@ struct Fail {
         FAIL(message);
     }
 };
+#endif
 }  // namespace c2mm::mock::reporters
 
 #endif  // C2MM__MOCK__REPORTERS__FAIL_HPP_
@@ -0,0 +1,147 @@
+#ifndef C2MM__MOCK__STATS__COUNTERS_HPP_
+#define C2MM__MOCK__STATS__COUNTERS_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "c2mm/mock/stats/Registry.hpp"
+#include "c2mm/mock/stats/Statistics.hpp"
+
+namespace c2mm::mock::stats {
+/**
+ * A statistics policy for mocks which counts what the mock does.
+ *
+ * Counters are atomic so they may be updated by concurrent calls. When the
+ * mock is destroyed its @c Statistics are published to @c
+ * Registry::instance().
+ *
+ * Keeping statistics is not free. Timing reads the clock twice per call which
+ * has expectations and twice per verification, and tracking the peak log
+ * size reads the size of the log on every logged call. Storage meant for
+ * concurrent calls, such as @c storage::Sharded, reads its size without
+ * locking.
+ */
+class Counters {
+  public:
+    /**
+     * Adds the time from its construction to its destruction to the time
+     * spent matching.
+     */
+    class Timer {
+      public:
+        explicit Timer (Counters& counters)
+              : counters_{counters}, start_{Clock::now()} {}
+
+        Timer (Timer const&) = delete;
+        Timer& operator = (Timer const&) = delete;
+
+        ~Timer () {
+            auto const elapsed = std::chrono::duration_cast<
+                std::chrono::nanoseconds
+            >(Clock::now() - start_);
+            counters_.matching_ns_.fetch_add(
+                static_cast<std::uint64_t>(elapsed.count()),
+                std::memory_order_relaxed
+            );
+        }
+
+      private:
+        using Clock = std::chrono::steady_clock;
+
+        Counters& counters_;
+        Clock::time_point start_;
+    };
+
+    Counters () = default;
+    Counters (Counters const&) = delete;
+    Counters& operator = (Counters const&) = delete;
+
+    /**
+     * Name the mock, to identify its statistics.
+     */
+    void set_name (std::string name) { name_ = std::move(name); }
+
+    /**
+     * Count a call made to the mock.
+     */
+    void count_call () { increment(calls_); }
+
+    /**
+     * Count a call handled by an expectation's action.
+     */
+    void count_handled () { increment(handled_); }
+
+    /**
+     * Count a call added to @p log and track the peak size of @p log.
+     */
+    template <typename T_Log>
+    void count_logged (T_Log const& log) {
+        increment(logged_);
+
+        auto const size = static_cast<std::uint64_t>(log.size());
+        auto peak = peak_log_size_.load(std::memory_order_relaxed);
+        while (size > peak and not peak_log_size_.compare_exchange_weak(
+            peak,
+            size,
+            std::memory_order_relaxed
+        )) {}
+    }
+
+    /**
+     * Time finding the expectations for a call until the result is destroyed.
+     */
+    [[nodiscard]] Timer time_matching () { return Timer{*this}; }
+
+    /**
+     * Count a scan of the log and time it until the result is destroyed.
+     */
+    [[nodiscard]] Timer time_scan () {
+        increment(scans_);
+        return Timer{*this};
+    }
+
+    /**
+     * The statistics counted so far.
+     */
+    Statistics snapshot () const {
+        auto const load = [] (std::atomic<std::uint64_t> const& counter) {
+            return counter.load(std::memory_order_relaxed);
+        };
+
+        return {
+            .name = name_,
+            .calls = load(calls_),
+            .handled = load(handled_),
+            .logged = load(logged_),
+            .peak_log_size = load(peak_log_size_),
+            .scans = load(scans_),
+            .matching_time = std::chrono::nanoseconds(
+                static_cast<std::int64_t>(load(matching_ns_))
+            ),
+        };
+    }
+
+    /**
+     * Publish the statistics counted so far to @c Registry::instance().
+     */
+    void publish () { Registry::instance().add(snapshot()); }
+
+  private:
+    static void increment (std::atomic<std::uint64_t>& counter) {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::string name_{};
+    std::atomic<std::uint64_t> calls_{0};
+    std::atomic<std::uint64_t> handled_{0};
+    std::atomic<std::uint64_t> logged_{0};
+    std::atomic<std::uint64_t> peak_log_size_{0};
+    std::atomic<std::uint64_t> scans_{0};
+    std::atomic<std::uint64_t> matching_ns_{0};
+};
+}  // namespace c2mm::mock::stats
+
+#endif  // C2MM__MOCK__STATS__COUNTERS_HPP_
@@ -0,0 +1,80 @@
+#include "c2mm/mock/stats/Counters.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/mock/Mock_Function.hpp"
+#include "c2mm/mock/reporters/Fail_Check.hpp"
+#include "c2mm/mock/storage/Heap.hpp"
+#include "c2mm/mock/stats/Registry.hpp"
+#include "c2mm/mock/threading/Single_Threaded.hpp"
+
+SCENARIO ("A Mock_Function with Counters keeps statistics.") {
+    using c2mm::matchers::greater_than;
+    using c2mm::mock::stats::Registry;
+
+    using Counted_Mock = c2mm::mock::Mock_Function<
+        void(int),
+        c2mm::mock::reporters::Fail_Check,
+        c2mm::mock::storage::Heap,
+        c2mm::mock::threading::Single_Threaded,
+        c2mm::mock::capture::Value,
+        c2mm::mock::stats::Counters
+    >;
+
+    Registry::instance().take();
+
+    GIVEN ("a named mock which is called and verified") {
+        c2mm::mock::stats::Statistics stats{};
+        {
+            Counted_Mock func{};
+            func.statistics().set_name("sink");
+            func.make_expectation(greater_than(100));
+
+            for (int i : {1, 2, 3, 500}) {
+                func(int{i});
+            }
+            func.check_called(2);
+            func.check_all_called(std::vector{
+                std::tuple{1},
+                std::tuple{3},
+            });
+
+            stats = func.statistics().snapshot();
+        }
+
+        THEN ("its statistics are counted") {
+            CHECK(stats.name == "sink");
+            CHECK(stats.calls == 4);
+            CHECK(stats.handled == 1);
+            CHECK(stats.logged == 3);
+            CHECK(stats.peak_log_size == 3);
+            CHECK(stats.scans == 2);
+            CHECK(stats.matching_time.count() > 0);
+        }
+
+        THEN ("they are published when it is destroyed") {
+            auto const published = Registry::instance().take();
+            REQUIRE(published.size() == 1);
+            CHECK(published[0].name == "sink");
+            CHECK(published[0].calls == 4);
+            CHECK(Registry::instance().take().empty());
+        }
+    }
+
+    GIVEN ("a mock without statistics") {
+        {
+            c2mm::mock::Mock_Function<void(int)> func{};
+            func(1);
+            func.check_called(1);
+        }
+
+        THEN ("nothing is published") {
+            CHECK(Registry::instance().take().empty());
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef C2MM__MOCK__STATS__JSON_LISTENER_HPP_
+#define C2MM__MOCK__STATS__JSON_LISTENER_HPP_
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <catch2/catch_test_case_info.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+
+#include "c2mm/mock/stats/Registry.hpp"
+#include "c2mm/mock/stats/json.hpp"
+
+namespace c2mm::mock::stats {
+/**
+ * Catch2 event listener which writes the statistics of every mock, grouped
+ * by test case, to a JSON file.
+ *
+ * Only mocks using the @c Counters statistics policy are included. At the
+ * end of each test case, the statistics published to @c Registry::instance()
+ * during it are taken. At the end of the run, the test cases with any
+ * statistics are written as a JSON array of the objects @c write_json
+ * describes. The file is named by the @c C2MM_STATS_JSON environment
+ * variable, or else is @c c2mm-stats.json in the working directory.
+ *
+ * Register it in exactly one translation unit of the test executable:
+ *
+ * @code{.cpp}
+ * CATCH_REGISTER_LISTENER(c2mm::mock::stats::Json_Listener)
+ * @endcode
+ */
+class Json_Listener : public Catch::EventListenerBase {
+  public:
+    using Catch::EventListenerBase::EventListenerBase;
+
+    void testCaseEnded (Catch::TestCaseStats const& stats) override {
+        auto const mocks = Registry::instance().take();
+        if (mocks.empty()) {
+            return;
+        }
+
+        json_ << separator_;
+        write_json(json_, stats.testInfo->name, mocks);
+        separator_ = ",\n";
+    }
+
+    void testRunEnded (Catch::TestRunStats const&) override {
+        char const* path = std::getenv("C2MM_STATS_JSON");
+        std::ofstream out{path ? path : "c2mm-stats.json"};
+        out << "[" << json_.str() << "]\n";
+    }
+
+  private:
+    std::ostringstream json_{};
+    char const* separator_ = "";
+};
+}  // namespace c2mm::mock::stats
+
+#endif  // C2MM__MOCK__STATS__JSON_LISTENER_HPP_
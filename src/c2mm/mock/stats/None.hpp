@@ -0,0 +1,30 @@
+#ifndef C2MM__MOCK__STATS__NONE_HPP_
+#define C2MM__MOCK__STATS__NONE_HPP_
+
+namespace c2mm::mock::stats {
+/**
+ * A statistics policy for mocks which keeps no statistics.
+ *
+ * This is the default policy. Every operation does nothing and compiles away.
+ * See @c Counters for the interface a statistics policy provides.
+ */
+struct None {
+    /**
+     * Measures nothing.
+     */
+    struct Timer {};
+
+    void count_call () {}
+    void count_handled () {}
+
+    template <typename T_Log>
+    void count_logged (T_Log const&) {}
+
+    Timer time_matching () { return {}; }
+    Timer time_scan () { return {}; }
+
+    void publish () {}
+};
+}  // namespace c2mm::mock::stats
+
+#endif  // C2MM__MOCK__STATS__NONE_HPP_
@@ -0,0 +1,50 @@
+#ifndef C2MM__MOCK__STATS__REGISTRY_HPP_
+#define C2MM__MOCK__STATS__REGISTRY_HPP_
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "c2mm/mock/stats/Statistics.hpp"
+
+namespace c2mm::mock::stats {
+/**
+ * Collects the statistics of mocks as they are destroyed, until they are
+ * taken, e.g. by @c Json_Listener at the end of each test case.
+ *
+ * All operations are thread safe.
+ */
+class Registry {
+  public:
+    /**
+     * The registry mocks publish to.
+     */
+    static Registry& instance () {
+        static Registry registry{};
+        return registry;
+    }
+
+    /**
+     * Add the statistics of one mock.
+     */
+    void add (Statistics statistics) {
+        std::scoped_lock lock{mutex_};
+        entries_.push_back(std::move(statistics));
+    }
+
+    /**
+     * Remove and return every statistics added since they were last taken, in
+     * the order they were added.
+     */
+    std::vector<Statistics> take () {
+        std::scoped_lock lock{mutex_};
+        return std::exchange(entries_, {});
+    }
+
+  private:
+    std::mutex mutex_;
+    std::vector<Statistics> entries_;
+};
+}  // namespace c2mm::mock::stats
+
+#endif  // C2MM__MOCK__STATS__REGISTRY_HPP_
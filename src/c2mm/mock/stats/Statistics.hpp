@@ -0,0 +1,30 @@
+#ifndef C2MM__MOCK__STATS__STATISTICS_HPP_
+#define C2MM__MOCK__STATS__STATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace c2mm::mock::stats {
+/**
+ * Snapshot of the statistics a mock kept over its lifetime.
+ */
+struct Statistics {
+    /// Name given to the mock, if any.
+    std::string name{};
+    /// Calls made to the mock.
+    std::uint64_t calls = 0;
+    /// Calls handled by an expectation's action.
+    std::uint64_t handled = 0;
+    /// Calls logged to be verified later.
+    std::uint64_t logged = 0;
+    /// Largest number of calls in the log at once.
+    std::uint64_t peak_log_size = 0;
+    /// Scans of the log to verify calls, e.g. by @c check_called.
+    std::uint64_t scans = 0;
+    /// Time spent finding the expectation for calls and scanning the log.
+    std::chrono::nanoseconds matching_time{0};
+};
+}  // namespace c2mm::mock::stats
+
+#endif  // C2MM__MOCK__STATS__STATISTICS_HPP_
@@ -0,0 +1,78 @@
+#ifndef C2MM__MOCK__STATS__JSON_HPP_
+#define C2MM__MOCK__STATS__JSON_HPP_
+
+#include <cstdio>
+#include <ostream>
+#include <span>
+#include <string_view>
+
+#include "c2mm/mock/stats/Statistics.hpp"
+
+namespace c2mm::mock::stats {
+/**
+ * Write @p text as a quoted JSON string.
+ * @param[out] out Stream to write to.
+ * @param[in] text Text to quote, assumed to be UTF-8.
+ */
+inline void write_json_string (std::ostream& out, std::string_view text) {
+    out << '"';
+    for (char const c : text) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\r': out << "\\r"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[7];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out << escaped;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+/**
+ * Write the statistics of the mocks of one test case as a JSON object:
+ *
+ * @code{.json}
+ * {"test_case": "...", "mocks": [{"name": "...", "calls": 3, "handled": 1,
+ *   "logged": 2, "peak_log_size": 2, "scans": 1, "matching_ns": 1200}]}
+ * @endcode
+ *
+ * @param[out] out Stream to write to.
+ * @param[in] test_case Name of the test case.
+ * @param[in] mocks Statistics of each mock, in order.
+ */
+inline void write_json (
+    std::ostream& out,
+    std::string_view test_case,
+    std::span<Statistics const> mocks
+) {
+    out << "{\"test_case\": ";
+    write_json_string(out, test_case);
+    out << ", \"mocks\": [";
+
+    char const* separator = "";
+    for (auto const& mock : mocks) {
+        out << separator << "{\"name\": ";
+        write_json_string(out, mock.name);
+        out << ", \"calls\": " << mock.calls
+            << ", \"handled\": " << mock.handled
+            << ", \"logged\": " << mock.logged
+            << ", \"peak_log_size\": " << mock.peak_log_size
+            << ", \"scans\": " << mock.scans
+            << ", \"matching_ns\": " << mock.matching_time.count()
+            << "}";
+        separator = ", ";
+    }
+
+    out << "]}";
+}
+}  // namespace c2mm::mock::stats
+
+#endif  // C2MM__MOCK__STATS__JSON_HPP_
@@ -0,0 +1,42 @@
+#include "c2mm/mock/stats/json.hpp"
+
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE ("c2mm::mock::stats::write_json") {
+    using namespace c2mm::mock::stats;
+
+    std::ostringstream out{};
+
+    SECTION ("each mock is an object in the test case's list") {
+        std::vector<Statistics> const mocks{
+            {
+                .name = "a",
+                .calls = 3,
+                .handled = 1,
+                .logged = 2,
+                .peak_log_size = 2,
+                .scans = 1,
+                .matching_time = std::chrono::nanoseconds{1200},
+            },
+            {.name = "b"},
+        };
+        write_json(out, "my test", mocks);
+
+        CHECK(out.str() ==
+            R"({"test_case": "my test", "mocks": [)"
+            R"({"name": "a", "calls": 3, "handled": 1, "logged": 2, )"
+            R"("peak_log_size": 2, "scans": 1, "matching_ns": 1200}, )"
+            R"({"name": "b", "calls": 0, "handled": 0, "logged": 0, )"
+            R"("peak_log_size": 0, "scans": 0, "matching_ns": 0}]})"
+        );
+    }
+
+    SECTION ("strings are escaped") {
+        write_json_string(out, "say \"hi\"\\\n\x01");
+        CHECK(out.str() == R"("say \"hi\"\\\n\u0001")");
+    }
+}
@@ -0,0 +1,298 @@
+#ifndef C2MM__MOCK__STORAGE__CHUNKED_HPP_
+#define C2MM__MOCK__STORAGE__CHUNKED_HPP_
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace c2mm::mock::storage {
+/**
+ * Call list which stores entries inline in fixed-size, contiguous chunks.
+ *
+ * Entries never move once constructed, so references to them stay valid until
+ * they are erased. Erasing an entry only destroys it and leaves a tombstone in
+ * its slot, which is constant time. The list tracks the first live slot so
+ * that consuming entries in the order they were added never rescans the
+ * consumed prefix, and chunks which fall entirely before that slot are
+ * released. Chunks are allocated from the memory resource given at
+ * construction.
+ *
+ * @tparam T The type of entry to store.
+ * @tparam t_chunk_size Number of entries per chunk.
+ */
+template <typename T, std::size_t t_chunk_size = 64>
+class Chunked_List {
+    static_assert(t_chunk_size > 0);
+
+    struct Chunk {
+        Chunk () = default;
+        Chunk (Chunk const&) = delete;
+        Chunk& operator = (Chunk const&) = delete;
+
+        ~Chunk () {
+            for (std::size_t idx = 0; idx < t_chunk_size; ++idx) {
+                if (live[idx]) {
+                    std::destroy_at(slot(idx));
+                }
+            }
+        }
+
+        T* slot (std::size_t idx) {
+            return std::launder(reinterpret_cast<T*>(storage) + idx);
+        }
+
+        T const* slot (std::size_t idx) const {
+            return std::launder(reinterpret_cast<T const*>(storage) + idx);
+        }
+
+        alignas(T) std::byte storage[sizeof(T) * t_chunk_size];
+        std::array<bool, t_chunk_size> live{};
+    };
+
+  public:
+    using value_type = T;
+
+    /**
+     * Read-only iterator over the live entries of a @c Chunked_List.
+     */
+    class Iterator {
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+
+        Iterator () = default;
+        Iterator (Chunked_List const& list, std::size_t idx)
+              : list_{&list}, idx_{idx} {}
+
+        reference operator * () const { return *list_->entry(idx_); }
+        pointer operator -> () const { return list_->entry(idx_); }
+
+        Iterator& operator ++ () {
+            idx_ = list_->next_live(idx_ + 1);
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        friend bool operator == (Iterator const&, Iterator const&) = default;
+
+      private:
+        Chunked_List const* list_ = nullptr;
+        std::size_t idx_ = 0;
+    };
+
+    /**
+     * Construct an empty list.
+     * @param[in] resource Memory resource from which chunks are allocated.
+     */
+    explicit Chunked_List (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : chunks_{resource} {}
+
+    Chunked_List (Chunked_List&& other)
+          : chunks_{std::move(other.chunks_)},
+            end_{std::exchange(other.end_, 0)},
+            first_{std::exchange(other.first_, 0)},
+            size_{std::exchange(other.size_, 0)}
+    {}
+
+    /**
+     * Take the entries of @p other. Both lists must use the same memory
+     * resource.
+     */
+    Chunked_List& operator = (Chunked_List&& other) {
+        clear();
+        chunks_.swap(other.chunks_);
+        end_ = std::exchange(other.end_, 0);
+        first_ = std::exchange(other.first_, 0);
+        size_ = std::exchange(other.size_, 0);
+        return *this;
+    }
+
+    ~Chunked_List () { clear(); }
+
+    Iterator begin () const { return Iterator{*this, first_}; }
+    Iterator end () const { return Iterator{*this, end_}; }
+
+    /**
+     * Number of live entries currently stored.
+     */
+    std::size_t size () const { return size_; }
+
+    /**
+     * Indicates whether there are no live entries stored.
+     */
+    bool empty () const { return size_ == 0; }
+
+    /**
+     * Construct a new entry at the end of the list.
+     *
+     * Allocates only when the last chunk is full.
+     *
+     * @param[in] args... Arguments forwarded to the constructor of @p T.
+     *
+     * @return A reference to the new entry.
+     */
+    template <typename... T_Args>
+    T& emplace (T_Args&&... args) {
+        auto const [chunk_idx, slot_idx] = locate(end_);
+        if (chunk_idx == chunks_.size()) {
+            // Make room first so that a failed push_back cannot leak the
+            // chunk.
+            if (chunks_.size() == chunks_.capacity()) {
+                chunks_.reserve(2 * chunks_.capacity() + 1);
+            }
+            chunks_.push_back(allocator().template new_object<Chunk>());
+        }
+
+        Chunk& chunk = *chunks_[chunk_idx];
+        T* entry = std::construct_at(
+            chunk.slot(slot_idx),
+            std::forward<T_Args>(args)...
+        );
+        chunk.live[slot_idx] = true;
+
+        ++end_;
+        ++size_;
+        return *entry;
+    }
+
+    /**
+     * Remove the first live entry for which @p pred returns @c true.
+     *
+     * The scan starts at the first live entry. Removal itself is constant
+     * time.
+     *
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return @c true if an entry was removed.
+     */
+    template <typename T_Pred>
+    bool erase_first (T_Pred&& pred) {
+        for (std::size_t idx = first_; idx < end_; idx = next_live(idx + 1)) {
+            if (pred(*entry(idx))) {
+                erase(idx);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Remove every live entry for which @p pred returns @c true, in a single
+     * pass.
+     *
+     * @p pred is called exactly once per live entry, in order, so it may keep
+     * state between calls.
+     *
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return The number of entries removed.
+     */
+    template <typename T_Pred>
+    std::size_t erase_if (T_Pred&& pred) {
+        std::size_t num_erased = 0;
+        for (std::size_t idx = first_; idx < end_; idx = next_live(idx + 1)) {
+            if (pred(*entry(idx))) {
+                erase(idx);
+                ++num_erased;
+            }
+        }
+
+        return num_erased;
+    }
+
+    /**
+     * Remove all entries and release all chunks.
+     */
+    void clear () {
+        for (Chunk* chunk : chunks_) {
+            if (chunk) {
+                allocator().delete_object(chunk);
+            }
+        }
+        chunks_.clear();
+        end_ = 0;
+        first_ = 0;
+        size_ = 0;
+    }
+
+  private:
+    static std::pair<std::size_t, std::size_t> locate (std::size_t idx) {
+        return {idx / t_chunk_size, idx % t_chunk_size};
+    }
+
+    T const* entry (std::size_t idx) const {
+        auto const [chunk_idx, slot_idx] = locate(idx);
+        return chunks_[chunk_idx]->slot(slot_idx);
+    }
+
+    bool is_live (std::size_t idx) const {
+        auto const [chunk_idx, slot_idx] = locate(idx);
+        return chunks_[chunk_idx] and chunks_[chunk_idx]->live[slot_idx];
+    }
+
+    std::size_t next_live (std::size_t idx) const {
+        while (idx < end_ and not is_live(idx)) {
+            ++idx;
+        }
+        return idx;
+    }
+
+    void erase (std::size_t idx) {
+        auto const [chunk_idx, slot_idx] = locate(idx);
+        Chunk& chunk = *chunks_[chunk_idx];
+        std::destroy_at(chunk.slot(slot_idx));
+        chunk.live[slot_idx] = false;
+        --size_;
+
+        if (idx == first_) {
+            first_ = next_live(first_);
+
+            // Every chunk before the one holding `first_` is now dead.
+            auto const first_chunk = locate(first_).first;
+            for (auto i = chunk_idx; i < first_chunk; ++i) {
+                allocator().delete_object(std::exchange(chunks_[i], nullptr));
+            }
+        }
+    }
+
+    typename std::pmr::vector<Chunk*>::allocator_type allocator () const {
+        return chunks_.get_allocator();
+    }
+
+    std::pmr::vector<Chunk*> chunks_;
+    std::size_t end_ = 0;
+    std::size_t first_ = 0;
+    std::size_t size_ = 0;
+};
+
+/**
+ * Storage policy for @c Call_Log which stores logged calls in chunks.
+ *
+ * Suited to logs which receive a large number of calls: logging a call
+ * allocates only once per @p t_chunk_size calls and consuming a call is
+ * constant time once it is found. See @c Chunked_List.
+ *
+ * @tparam t_chunk_size Number of calls stored per chunk.
+ */
+template <std::size_t t_chunk_size = 64>
+struct Chunked {
+    template <typename T>
+    using List = Chunked_List<T, t_chunk_size>;
+};
+}  // namespace c2mm::mock::storage
+
+#endif  // C2MM__MOCK__STORAGE__CHUNKED_HPP_
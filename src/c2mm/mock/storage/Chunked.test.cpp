@@ -0,0 +1,144 @@
+#include "c2mm/mock/storage/Chunked.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+template <typename T_List>
+std::vector<int> contents (T_List const& list) {
+    std::vector<int> result{};
+    for (auto const& entry : list) {
+        result.push_back(*entry);
+    }
+    return result;
+}
+}  // namespace
+
+SCENARIO ("c2mm::mock::storage::Chunked_List stores entries in chunks") {
+    using c2mm::mock::storage::Chunked_List;
+
+    GIVEN ("a Chunked_List with small chunks") {
+        Chunked_List<std::shared_ptr<int>, 4> list{};
+
+        WHEN ("entries spanning several chunks are added") {
+            for (int i = 0; i < 10; ++i) {
+                list.emplace(std::make_shared<int>(i));
+            }
+            auto const& fifth = *std::next(list.begin(), 5);
+
+            THEN ("they are iterated in insertion order") {
+                CHECK(list.size() == 10);
+                CHECK(contents(list) == std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+            }
+
+            AND_WHEN ("entries are erased in order") {
+                for (int i = 0; i < 5; ++i) {
+                    CHECK(list.erase_first([i] (auto const& p) {
+                        return *p == i;
+                    }));
+                }
+
+                THEN ("the remaining entries are unaffected") {
+                    CHECK(list.size() == 5);
+                    CHECK(&*list.begin() == &fifth);
+                    CHECK(contents(list) == std::vector{5, 6, 7, 8, 9});
+                }
+            }
+
+            AND_WHEN ("entries are erased out of order") {
+                auto is = [] (int value) {
+                    return [value] (auto const& p) { return *p == value; };
+                };
+                CHECK(list.erase_first(is(7)));
+                CHECK(list.erase_first(is(0)));
+                CHECK(list.erase_first(is(3)));
+                CHECK(not list.erase_first(is(3)));
+
+                THEN ("only those entries are removed") {
+                    CHECK(list.size() == 7);
+                    CHECK(contents(list) == std::vector{1, 2, 4, 5, 6, 8, 9});
+                }
+
+                AND_WHEN ("more entries are added") {
+                    list.emplace(std::make_shared<int>(10));
+
+                    THEN ("they follow the remaining entries") {
+                        CHECK(contents(list) == std::vector{1, 2, 4, 5, 6, 8, 9, 10});
+                    }
+                }
+            }
+
+            AND_WHEN ("every other entry is erased in one pass") {
+                std::vector<int> visited{};
+                CHECK(list.erase_if([&visited] (auto const& p) {
+                    visited.push_back(*p);
+                    return *p % 2 == 0;
+                }) == 5);
+
+                THEN ("each entry is visited once and the rest are kept") {
+                    CHECK(visited == std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+                    CHECK(contents(list) == std::vector{1, 3, 5, 7, 9});
+                }
+            }
+
+            AND_WHEN ("every entry is erased") {
+                while (list.erase_first([] (auto const&) { return true; })) {}
+
+                THEN ("the list is empty") {
+                    CHECK(list.empty());
+                    CHECK(list.begin() == list.end());
+                }
+
+                AND_WHEN ("more entries are added") {
+                    list.emplace(std::make_shared<int>(42));
+
+                    THEN ("they can be found") {
+                        CHECK(contents(list) == std::vector{42});
+                    }
+                }
+            }
+
+            AND_WHEN ("the list is cleared") {
+                auto tracked = std::make_shared<int>(-1);
+                list.emplace(tracked);
+                list.clear();
+
+                THEN ("the entries are destroyed") {
+                    CHECK(list.empty());
+                    CHECK(tracked.use_count() == 1);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a Chunked_List with a memory resource") {
+        alignas(std::max_align_t) std::byte buffer[4096];
+        std::pmr::monotonic_buffer_resource arena{
+            buffer,
+            sizeof(buffer),
+            std::pmr::null_memory_resource()
+        };
+        Chunked_List<int, 4> list{&arena};
+
+        WHEN ("entries spanning several chunks are added") {
+            for (int i = 0; i < 10; ++i) {
+                list.emplace(i);
+            }
+
+            THEN ("every chunk is allocated from the resource") {
+                CHECK(list.size() == 10);
+                for (int const& entry : list) {
+                    auto const* address =
+                        reinterpret_cast<std::byte const*>(&entry);
+                    CHECK(address >= buffer);
+                    CHECK(address < buffer + sizeof(buffer));
+                }
+            }
+        }
+    }
+}
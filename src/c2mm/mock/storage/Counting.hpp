@@ -0,0 +1,186 @@
+#ifndef C2MM__MOCK__STORAGE__COUNTING_HPP_
+#define C2MM__MOCK__STORAGE__COUNTING_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "c2mm/matchers/Inline_Matcher.hpp"
+#include "c2mm/mock/args.hpp"
+
+namespace c2mm::mock::storage {
+/**
+ * Identifies a bucket registered with a @c Counting_List.
+ */
+struct Bucket_Id {
+    std::size_t index;
+};
+
+/**
+ * Call list which counts entries instead of storing them.
+ *
+ * Nothing is constructed or allocated when an entry is added. Optionally,
+ * matchers can be registered as buckets. Each entry is counted in the first
+ * bucket whose matcher accepts it, or else in a catch-all count.
+ *
+ * Because no entry is kept, iteration always yields nothing and @c
+ * erase_first never finds anything. Counted entries are consumed with @c take
+ * instead.
+ *
+ * @tparam T The type of entry to count. Must be a @c Captured_Args.
+ */
+template <typename T>
+class Counting_List {
+  public:
+    using value_type = T;
+    using Bucket_Matcher = matchers::Inline_Matcher<bound_args_for_t<T>>;
+
+    /**
+     * Construct a list with no buckets.
+     * @param[in] resource Memory resource from which buckets are allocated.
+     */
+    explicit Counting_List (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : buckets_{resource} {}
+
+    /**
+     * The memory resource buckets are allocated from. Matchers added as
+     * buckets should allocate from it too.
+     */
+    std::pmr::memory_resource* resource () const {
+        return buckets_.get_allocator().resource();
+    }
+
+    T const* begin () const { return nullptr; }
+    T const* end () const { return nullptr; }
+
+    /**
+     * Number of entries counted since they were last consumed.
+     */
+    std::size_t size () const { return size_; }
+
+    /**
+     * Indicates whether no entries are counted.
+     */
+    bool empty () const { return size_ == 0; }
+
+    /**
+     * Register a bucket. Entries added from now on which @p matcher accepts,
+     * and which no earlier bucket accepts, are counted in this bucket.
+     *
+     * @param[in] matcher Matcher accepting the entry's arguments bound as a @c
+     *     Bound_Args tuple.
+     *
+     * @return Identifier of the new bucket.
+     */
+    Bucket_Id add_bucket (Bucket_Matcher matcher) {
+        buckets_.emplace_back(std::move(matcher));
+        return {buckets_.size() - 1};
+    }
+
+    /**
+     * Number of entries counted in @p bucket since they were last consumed.
+     */
+    std::size_t count (Bucket_Id bucket) const {
+        return buckets_[bucket.index].count;
+    }
+
+    /**
+     * Count an entry with the given arguments. The arguments are only
+     * inspected by the bucket matchers.
+     * @param[in] args... Arguments which would construct the entry.
+     */
+    template <typename... T_Args>
+    void emplace (T_Args const&... args) {
+        static_assert(
+            std::is_same_v<Bound_Args<T_Args...>, bound_args_for_t<T>>,
+            "Counted arguments must have exactly the entry's element types."
+        );
+
+        ++size_;
+
+        if (buckets_.empty()) {
+            return;
+        }
+
+        auto const bound = bind_args(args...);
+        for (auto& bucket : buckets_) {
+            if (bucket.matcher.match(bound)) {
+                ++bucket.count;
+                return;
+            }
+        }
+    }
+
+    /**
+     * Always fails to find an entry, since entries are not stored.
+     * @return @c false
+     */
+    template <typename T_Pred>
+    bool erase_first (T_Pred&&) {
+        return false;
+    }
+
+    /**
+     * Always removes nothing, since entries are not stored.
+     * @return @c 0
+     */
+    template <typename T_Pred>
+    std::size_t erase_if (T_Pred&&) {
+        return 0;
+    }
+
+    /**
+     * Consume every counted entry.
+     * @return The number of entries consumed.
+     */
+    std::size_t take () {
+        for (auto& bucket : buckets_) {
+            bucket.count = 0;
+        }
+        return std::exchange(size_, 0);
+    }
+
+    /**
+     * Consume the entries counted in @p bucket.
+     * @return The number of entries consumed.
+     */
+    std::size_t take (Bucket_Id bucket) {
+        auto const taken = std::exchange(buckets_[bucket.index].count, 0);
+        size_ -= taken;
+        return taken;
+    }
+
+    /**
+     * Consume every counted entry. Buckets remain registered.
+     */
+    void clear () { take(); }
+
+  private:
+    struct Bucket {
+        explicit Bucket (Bucket_Matcher&& m) : matcher{std::move(m)} {}
+
+        Bucket_Matcher matcher;
+        std::size_t count = 0;
+    };
+
+    std::pmr::vector<Bucket> buckets_;
+    std::size_t size_ = 0;
+};
+
+/**
+ * Storage policy for @c Call_Log which only counts calls.
+ *
+ * Logging a call neither copies its arguments nor allocates. Calls can only be
+ * verified by count, either in total or per bucket. See @c Counting_List and
+ * @c Mock_Function::count_calls.
+ */
+struct Counting {
+    template <typename T>
+    using List = Counting_List<T>;
+};
+}  // namespace c2mm::mock::storage
+
+#endif  // C2MM__MOCK__STORAGE__COUNTING_HPP_
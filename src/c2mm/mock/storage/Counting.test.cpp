@@ -0,0 +1,61 @@
+#include "c2mm/mock/storage/Counting.hpp"
+
+#include <string>
+#include <tuple>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/matchers/Tuple_Matcher.hpp"
+#include "c2mm/matchers/Typed_Wrapper.hpp"
+#include "c2mm/mock/args.hpp"
+
+SCENARIO ("c2mm::mock::storage::Counting_List counts entries") {
+    using c2mm::matchers::less_than;
+    using c2mm::matchers::matches;
+    using c2mm::matchers::wrap_for;
+    using c2mm::mock::Bound_Args;
+    using c2mm::mock::storage::Counting_List;
+
+    GIVEN ("a Counting_List with buckets") {
+        Counting_List<std::tuple<int, std::string>> list{};
+        using Bound = Bound_Args<int, std::string>;
+
+        auto const negative = list.add_bucket(
+            wrap_for<Bound>(matches(std::tuple{less_than(0), std::string{"a"}}))
+        );
+        auto const small = list.add_bucket(
+            wrap_for<Bound>(matches(std::tuple{less_than(10), std::string{"a"}}))
+        );
+
+        WHEN ("entries are added") {
+            std::string const a = "a";
+            std::string const b = "b";
+            list.emplace(-1, a);
+            list.emplace(-2, a);
+            list.emplace(3, a);
+            list.emplace(3, b);
+            list.emplace(30, a);
+
+            THEN ("each is counted once, in the first bucket that matches") {
+                CHECK(list.size() == 5);
+                CHECK(list.count(negative) == 2);
+                CHECK(list.count(small) == 1);
+                CHECK(list.begin() == list.end());
+            }
+
+            THEN ("entries can be consumed by bucket") {
+                CHECK(list.take(negative) == 2);
+                CHECK(list.count(negative) == 0);
+                CHECK(list.size() == 3);
+                CHECK(list.take() == 3);
+                CHECK(list.empty());
+                CHECK(list.count(small) == 0);
+            }
+
+            THEN ("entries cannot be matched individually") {
+                CHECK(not list.erase_first([] (auto const&) { return true; }));
+            }
+        }
+    }
+}
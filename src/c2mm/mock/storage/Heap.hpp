@@ -0,0 +1,179 @@
+#ifndef C2MM__MOCK__STORAGE__HEAP_HPP_
+#define C2MM__MOCK__STORAGE__HEAP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace c2mm::mock::storage {
+/**
+ * Call list which allocates each entry individually on the heap.
+ *
+ * Entries are kept in insertion order in a vector of owning pointers. Erasing
+ * an entry shifts every entry after it. Both the entries and the vector are
+ * allocated from the memory resource given at construction.
+ *
+ * @tparam T The type of entry to store.
+ */
+template <typename T>
+class Heap_List {
+    using Container = std::pmr::vector<T*>;
+
+  public:
+    using value_type = T;
+
+    /**
+     * Read-only iterator over the entries of a @c Heap_List.
+     */
+    class Iterator {
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+
+        Iterator () = default;
+        explicit Iterator (typename Container::const_iterator iter)
+              : iter_{iter} {}
+
+        reference operator * () const { return **iter_; }
+        pointer operator -> () const { return *iter_; }
+
+        Iterator& operator ++ () {
+            ++iter_;
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator prev = *this;
+            ++iter_;
+            return prev;
+        }
+
+        friend bool operator == (Iterator const&, Iterator const&) = default;
+
+      private:
+        typename Container::const_iterator iter_;
+    };
+
+    /**
+     * Construct an empty list.
+     * @param[in] resource Memory resource from which entries are allocated.
+     */
+    explicit Heap_List (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : entries_{resource} {}
+
+    Heap_List (Heap_List&& other) : entries_{std::move(other.entries_)} {}
+
+    Heap_List& operator = (Heap_List&&) = delete;
+
+    ~Heap_List () { clear(); }
+
+    Iterator begin () const { return Iterator{entries_.begin()}; }
+    Iterator end () const { return Iterator{entries_.end()}; }
+
+    /**
+     * Number of entries currently stored.
+     */
+    std::size_t size () const { return entries_.size(); }
+
+    /**
+     * Indicates whether there are no entries stored.
+     */
+    bool empty () const { return entries_.empty(); }
+
+    /**
+     * Construct a new entry at the end of the list.
+     * @param[in] args... Arguments forwarded to the constructor of @p T.
+     */
+    template <typename... T_Args>
+    void emplace (T_Args&&... args) {
+        // Make room first so that a failed push_back cannot leak the entry.
+        if (entries_.size() == entries_.capacity()) {
+            entries_.reserve(2 * entries_.capacity() + 1);
+        }
+        entries_.push_back(
+            allocator().template new_object<T>(std::forward<T_Args>(args)...)
+        );
+    }
+
+    /**
+     * Remove the first entry for which @p pred returns @c true.
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return @c true if an entry was removed.
+     */
+    template <typename T_Pred>
+    bool erase_first (T_Pred&& pred) {
+        auto iter = std::ranges::find_if(
+            entries_,
+            [&pred] (auto const& entry) { return pred(*entry); }
+        );
+
+        if (iter == entries_.end()) {
+            return false;
+        }
+
+        allocator().delete_object(*iter);
+        entries_.erase(iter);
+        return true;
+    }
+
+    /**
+     * Remove every entry for which @p pred returns @c true, in a single pass.
+     *
+     * @p pred is called exactly once per entry, in order, so it may keep
+     * state between calls.
+     *
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return The number of entries removed.
+     */
+    template <typename T_Pred>
+    std::size_t erase_if (T_Pred&& pred) {
+        return std::erase_if(entries_, [this, &pred] (T* entry) {
+            if (not pred(std::as_const(*entry))) {
+                return false;
+            }
+            allocator().delete_object(entry);
+            return true;
+        });
+    }
+
+    /**
+     * Remove all entries.
+     */
+    void clear () {
+        for (T* entry : entries_) {
+            allocator().delete_object(entry);
+        }
+        entries_.clear();
+    }
+
+  private:
+    typename Container::allocator_type allocator () const {
+        return entries_.get_allocator();
+    }
+
+    Container entries_;
+};
+
+/**
+ * Storage policy for @c Call_Log which allocates every logged call separately.
+ *
+ * This is the default policy. It is simple and makes no assumptions about the
+ * logged types but each logged call costs one allocation and each consumed call
+ * costs a shift of the remainder of the log. Allocations come from the memory
+ * resource the list is constructed with.
+ */
+struct Heap {
+    template <typename T>
+    using List = Heap_List<T>;
+};
+}  // namespace c2mm::mock::storage
+
+#endif  // C2MM__MOCK__STORAGE__HEAP_HPP_
@@ -0,0 +1,349 @@
+#ifndef C2MM__MOCK__STORAGE__MAPPED_HPP_
+#define C2MM__MOCK__STORAGE__MAPPED_HPP_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "c2mm/mock/Serializer.hpp"
+
+namespace c2mm::mock::storage {
+/**
+ * Call list which streams entries to a memory-mapped, append-only file.
+ *
+ * Each entry is written with its @c Serializer into a record in a temporary
+ * file, which is unlinked as soon as it is created so that it disappears with
+ * the list. Pages of the file are written back and evicted by the operating
+ * system as needed, so the list can hold far more entries than fit in memory.
+ *
+ * Every scan walks the records in file order, starting at the first live
+ * one. Erasing an entry only clears a flag in its record. Dereferencing an
+ * iterator deserializes the entry into the iterator, so iterators are input
+ * iterators and references are invalidated when the iterator is advanced.
+ *
+ * Only available on POSIX systems.
+ *
+ * @tparam T The type of entry to store. Must be @c Serializable.
+ */
+template <Serializable T>
+class Mapped_List {
+    // Each record is a header followed by the serialized entry, padded so the
+    // next header is aligned.
+    struct Header {
+        std::uint32_t size;
+        std::uint32_t live;
+    };
+
+    static constexpr std::size_t initial_capacity = std::size_t{1} << 20;
+
+  public:
+    using value_type = T;
+
+    /**
+     * Read-only iterator over the live entries of a @c Mapped_List.
+     */
+    class Iterator {
+      public:
+        using iterator_concept = std::input_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+
+        Iterator () = default;
+        Iterator (Mapped_List const& list, std::size_t offset)
+              : list_{&list}, offset_{offset} {}
+
+        reference operator * () const { return *load(); }
+        pointer operator -> () const { return &*load(); }
+
+        Iterator& operator ++ () {
+            offset_ = list_->next_live(list_->next_record(offset_));
+            entry_.reset();
+            return *this;
+        }
+
+        void operator ++ (int) { ++*this; }
+
+        friend bool operator == (Iterator const& lhs, Iterator const& rhs) {
+            return lhs.offset_ == rhs.offset_;
+        }
+
+      private:
+        std::optional<T> const& load () const {
+            if (not entry_) {
+                entry_.emplace(list_->entry(offset_));
+            }
+            return entry_;
+        }
+
+        Mapped_List const* list_ = nullptr;
+        std::size_t offset_ = 0;
+        mutable std::optional<T> entry_{};
+    };
+
+    /**
+     * Create the backing file and map it.
+     *
+     * @param[in] directory Directory in which to create the backing file.
+     *
+     * @throws std::system_error If the file cannot be created or mapped.
+     */
+    explicit Mapped_List (
+        std::filesystem::path const& directory =
+            std::filesystem::temp_directory_path()
+    ) {
+        std::string path = (directory / "c2mm-calls-XXXXXX").string();
+        fd_ = ::mkstemp(path.data());
+        if (fd_ < 0) {
+            throw_errno("cannot create call log file");
+        }
+        ::unlink(path.c_str());
+
+        // The destructor does not run if this throws.
+        try {
+            remap(initial_capacity);
+        } catch (...) {
+            ::close(fd_);
+            throw;
+        }
+    }
+
+    /**
+     * Create the backing file in the default temporary directory. Entries are
+     * never allocated from @p resource.
+     */
+    explicit Mapped_List (std::pmr::memory_resource*) : Mapped_List{} {}
+
+    Mapped_List (Mapped_List&& other)
+          : fd_{std::exchange(other.fd_, -1)},
+            data_{std::exchange(other.data_, nullptr)},
+            capacity_{std::exchange(other.capacity_, 0)},
+            end_{std::exchange(other.end_, 0)},
+            first_{std::exchange(other.first_, 0)},
+            size_{std::exchange(other.size_, 0)}
+    {}
+
+    Mapped_List& operator = (Mapped_List&&) = delete;
+
+    ~Mapped_List () {
+        if (data_) {
+            ::munmap(data_, capacity_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    Iterator begin () const { return Iterator{*this, first_}; }
+    Iterator end () const { return Iterator{*this, end_}; }
+
+    /**
+     * Number of live entries currently stored.
+     */
+    std::size_t size () const { return size_; }
+
+    /**
+     * Indicates whether there are no live entries stored.
+     */
+    bool empty () const { return size_ == 0; }
+
+    /**
+     * Number of bytes of the backing file in use, including erased records.
+     */
+    std::size_t bytes_used () const { return end_; }
+
+    /**
+     * Serialize a new entry at the end of the file, growing the file if
+     * needed.
+     *
+     * @param[in] args... Arguments forwarded to the constructor of @p T.
+     *
+     * @throws std::system_error If the file cannot be grown.
+     * @throws std::length_error If the serialized entry is 4 GiB or more.
+     */
+    template <typename... T_Args>
+    void emplace (T_Args&&... args) {
+        T const value(std::forward<T_Args>(args)...);
+        auto const size = Serializer<T>::size(value);
+        if (size > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error{"serialized call is too large to log"};
+        }
+        auto const record_size = sizeof(Header) + padded(size);
+
+        if (end_ + record_size > capacity_) {
+            auto capacity = capacity_;
+            while (end_ + record_size > capacity) {
+                capacity *= 2;
+            }
+            remap(capacity);
+        }
+
+        write_header(end_, {static_cast<std::uint32_t>(size), 1});
+        Serializer<T>::write(value, data_ + end_ + sizeof(Header));
+        end_ += record_size;
+        ++size_;
+    }
+
+    /**
+     * Remove the first live entry for which @p pred returns @c true.
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return @c true if an entry was removed.
+     */
+    template <typename T_Pred>
+    bool erase_first (T_Pred&& pred) {
+        for (auto off = first_; off < end_; off = next_live(next_record(off))) {
+            if (T const value = entry(off); pred(value)) {
+                erase(off);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Remove every live entry for which @p pred returns @c true, in a single
+     * pass.
+     *
+     * @p pred is called exactly once per live entry, in order, so it may keep
+     * state between calls.
+     *
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return The number of entries removed.
+     */
+    template <typename T_Pred>
+    std::size_t erase_if (T_Pred&& pred) {
+        std::size_t num_erased = 0;
+        for (auto off = first_; off < end_; off = next_live(next_record(off))) {
+            if (T const value = entry(off); pred(value)) {
+                erase(off);
+                ++num_erased;
+            }
+        }
+
+        return num_erased;
+    }
+
+    /**
+     * Remove all entries. The file keeps its size and is overwritten by later
+     * entries.
+     */
+    void clear () {
+        end_ = 0;
+        first_ = 0;
+        size_ = 0;
+    }
+
+  private:
+    static std::size_t padded (std::size_t size) {
+        return (size + alignof(Header) - 1) / alignof(Header) * alignof(Header);
+    }
+
+    [[noreturn]] static void throw_errno (char const* what) {
+        throw std::system_error{errno, std::generic_category(), what};
+    }
+
+    void remap (std::size_t capacity) {
+        if (::ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+            throw_errno("cannot grow call log file");
+        }
+
+        void* data = ::mmap(
+            nullptr,
+            capacity,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED,
+            fd_,
+            0
+        );
+        if (data == MAP_FAILED) {
+            throw_errno("cannot map call log file");
+        }
+        ::madvise(data, capacity, MADV_SEQUENTIAL);
+
+        if (data_) {
+            ::munmap(data_, capacity_);
+        }
+        data_ = static_cast<std::byte*>(data);
+        capacity_ = capacity;
+    }
+
+    Header read_header (std::size_t offset) const {
+        Header header;
+        std::memcpy(&header, data_ + offset, sizeof(Header));
+        return header;
+    }
+
+    void write_header (std::size_t offset, Header header) {
+        std::memcpy(data_ + offset, &header, sizeof(Header));
+    }
+
+    T entry (std::size_t offset) const {
+        return Serializer<T>::read(
+            data_ + offset + sizeof(Header),
+            read_header(offset).size
+        );
+    }
+
+    std::size_t next_record (std::size_t offset) const {
+        return offset + sizeof(Header) + padded(read_header(offset).size);
+    }
+
+    std::size_t next_live (std::size_t offset) const {
+        while (offset < end_ and not read_header(offset).live) {
+            offset = next_record(offset);
+        }
+        return offset;
+    }
+
+    void erase (std::size_t offset) {
+        auto header = read_header(offset);
+        header.live = 0;
+        write_header(offset, header);
+        --size_;
+
+        if (offset == first_) {
+            first_ = next_live(first_);
+        }
+    }
+
+    int fd_ = -1;
+    std::byte* data_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t end_ = 0;
+    std::size_t first_ = 0;
+    std::size_t size_ = 0;
+};
+
+/**
+ * Storage policy for @c Call_Log which streams logged calls to a
+ * memory-mapped file.
+ *
+ * Suited to logs which receive more calls than fit in memory. Every argument
+ * type must be @c Serializable. Logging a call serializes it and scanning the
+ * log deserializes each call in turn. See @c Mapped_List.
+ */
+struct Mapped {
+    template <typename T>
+    using List = Mapped_List<T>;
+};
+}  // namespace c2mm::mock::storage
+
+#endif  // C2MM__MOCK__STORAGE__MAPPED_HPP_
@@ -0,0 +1,146 @@
+#include "c2mm/mock/storage/Mapped.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/matchers/Comparison_Matcher.hpp"
+#include "c2mm/mock/Mock_Function.hpp"
+
+namespace {
+template <typename T_List>
+std::vector<int> contents (T_List const& list) {
+    std::vector<int> result{};
+    for (auto const& entry : list) {
+        result.push_back(std::get<0>(entry));
+    }
+    return result;
+}
+
+// Claims to serialize to more bytes than a record can hold.
+struct Huge {};
+}  // namespace
+
+template <>
+struct c2mm::mock::Serializer<Huge> {
+    static std::size_t size (Huge const&) { return std::size_t{5} << 30; }
+    static void write (Huge const&, std::byte*) {}
+    static Huge read (std::byte const*, std::size_t) { return {}; }
+};
+
+SCENARIO ("c2mm::mock::storage::Mapped_List streams entries to a file") {
+    using c2mm::mock::storage::Mapped_List;
+
+    GIVEN ("a Mapped_List") {
+        Mapped_List<std::tuple<int, std::string>> list{};
+
+        WHEN ("entries are added") {
+            for (int i = 0; i < 5; ++i) {
+                list.emplace(i, std::string(i, 'x'));
+            }
+
+            THEN ("they are iterated in insertion order") {
+                CHECK(list.size() == 5);
+                CHECK(contents(list) == std::vector{0, 1, 2, 3, 4});
+                CHECK(std::get<1>(*std::next(list.begin(), 3)) == "xxx");
+            }
+
+            AND_WHEN ("entries are erased") {
+                CHECK(list.erase_first([] (auto const& entry) {
+                    return std::get<0>(entry) == 0;
+                }));
+                CHECK(list.erase_first([] (auto const& entry) {
+                    return std::get<1>(entry) == "xx";
+                }));
+                CHECK(not list.erase_first([] (auto const& entry) {
+                    return std::get<0>(entry) == 2;
+                }));
+
+                THEN ("the rest are kept in order") {
+                    CHECK(list.size() == 3);
+                    CHECK(contents(list) == std::vector{1, 3, 4});
+                }
+            }
+
+            AND_WHEN ("entries are erased in a single pass") {
+                std::vector<int> visited{};
+                CHECK(list.erase_if([&visited] (auto const& entry) {
+                    visited.push_back(std::get<0>(entry));
+                    return std::get<0>(entry) % 2 == 0;
+                }) == 3);
+
+                THEN ("each entry is visited once and the rest are kept") {
+                    CHECK(visited == std::vector{0, 1, 2, 3, 4});
+                    CHECK(contents(list) == std::vector{1, 3});
+                }
+            }
+
+            AND_WHEN ("the list is cleared") {
+                list.clear();
+                list.emplace(42, "");
+
+                THEN ("the file is reused") {
+                    CHECK(contents(list) == std::vector{42});
+                }
+            }
+        }
+
+        WHEN ("more entries are added than fit in the initial mapping") {
+            constexpr int num_entries = 200'000;
+            for (int i = 0; i < num_entries; ++i) {
+                list.emplace(i, "abc");
+            }
+
+            THEN ("the file grows and every entry is kept") {
+                CHECK(list.size() == num_entries);
+                CHECK(list.bytes_used() > std::size_t{1} << 20);
+
+                int expected = 0;
+                bool ordered = true;
+                for (auto const& [i, text] : list) {
+                    ordered = ordered and i == expected++ and text == "abc";
+                }
+                CHECK(ordered);
+                CHECK(expected == num_entries);
+            }
+        }
+    }
+}
+
+TEST_CASE ("c2mm::mock::storage::Mapped_List rejects entries of 4 GiB") {
+    c2mm::mock::storage::Mapped_List<Huge> list{};
+    CHECK_THROWS_AS(list.emplace(), std::length_error);
+    CHECK(list.empty());
+    CHECK(list.bytes_used() == 0);
+}
+
+SCENARIO ("A Mapped Mock_Function verifies calls from the file.") {
+    GIVEN ("a Mock_Function which streams calls to a file") {
+        using c2mm::matchers::greater_than;
+
+        c2mm::mock::Mock_Function<
+            void(int, std::string),
+            c2mm::mock::reporters::Fail_Check,
+            c2mm::mock::storage::Mapped
+        > func{};
+
+        WHEN ("it is called") {
+            func(1, std::string{"one"});
+            func(2, std::string{"two"});
+            func(3, std::string{"three"});
+
+            THEN ("the calls can be consumed") {
+                func.check_called(greater_than(1), std::string{"two"});
+                func.check_all_called(std::vector{
+                    std::tuple{1, std::string{"one"}},
+                    std::tuple{3, std::string{"three"}},
+                });
+            }
+        }
+    }
+}
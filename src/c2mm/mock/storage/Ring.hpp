@@ -0,0 +1,265 @@
+#ifndef C2MM__MOCK__STORAGE__RING_HPP_
+#define C2MM__MOCK__STORAGE__RING_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace c2mm::mock::storage {
+/**
+ * Call list which keeps only the most recent entries in a fixed buffer.
+ *
+ * The buffer holds @p t_capacity slots and is allocated once, on
+ * construction, from the given memory resource. When every slot is in use,
+ * adding an entry evicts the oldest one and counts it as dropped. Erasing an
+ * entry leaves a tombstone in its slot which is reclaimed once it becomes the
+ * oldest slot, so the list always holds the unconsumed entries among the last
+ * @p t_capacity added.
+ *
+ * @tparam T The type of entry to store.
+ * @tparam t_capacity Maximum number of slots.
+ */
+template <typename T, std::size_t t_capacity>
+class Ring_List {
+    static_assert(t_capacity > 0);
+
+    struct Slot {
+        T* get () { return std::launder(reinterpret_cast<T*>(storage)); }
+
+        T const* get () const {
+            return std::launder(reinterpret_cast<T const*>(storage));
+        }
+
+        alignas(T) std::byte storage[sizeof(T)];
+        bool live = false;
+    };
+
+  public:
+    using value_type = T;
+
+    /**
+     * Read-only iterator over the live entries of a @c Ring_List, oldest
+     * first.
+     */
+    class Iterator {
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+
+        Iterator () = default;
+        Iterator (Ring_List const& list, std::size_t offset)
+              : list_{&list}, offset_{list.next_live(offset)} {}
+
+        reference operator * () const { return *list_->slot(offset_).get(); }
+        pointer operator -> () const { return list_->slot(offset_).get(); }
+
+        Iterator& operator ++ () {
+            offset_ = list_->next_live(offset_ + 1);
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        friend bool operator == (Iterator const&, Iterator const&) = default;
+
+      private:
+        Ring_List const* list_ = nullptr;
+        std::size_t offset_ = 0;
+    };
+
+    /**
+     * Construct an empty list and allocate its buffer.
+     * @param[in] resource Memory resource from which the buffer is allocated.
+     */
+    explicit Ring_List (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : allocator_{resource},
+        slots_{allocator_.allocate(t_capacity)} {
+        std::uninitialized_value_construct_n(slots_, t_capacity);
+    }
+
+    Ring_List (Ring_List&& other)
+          : allocator_{other.allocator_},
+            slots_{std::exchange(other.slots_, nullptr)},
+            head_{std::exchange(other.head_, 0)},
+            used_{std::exchange(other.used_, 0)},
+            size_{std::exchange(other.size_, 0)},
+            dropped_{std::exchange(other.dropped_, 0)}
+    {}
+
+    Ring_List& operator = (Ring_List&&) = delete;
+
+    ~Ring_List () {
+        if (slots_) {
+            clear();
+            allocator_.deallocate(slots_, t_capacity);
+        }
+    }
+
+    Iterator begin () const { return Iterator{*this, 0}; }
+    Iterator end () const { return Iterator{*this, used_}; }
+
+    /**
+     * Number of live entries currently stored.
+     */
+    std::size_t size () const { return size_; }
+
+    /**
+     * Indicates whether there are no live entries stored.
+     */
+    bool empty () const { return size_ == 0; }
+
+    /**
+     * Number of live entries evicted to make room for newer ones since the
+     * list was last cleared.
+     */
+    std::size_t dropped () const { return dropped_; }
+
+    /**
+     * Construct a new entry after all others, evicting the oldest entry if the
+     * buffer is full.
+     * @param[in] args... Arguments forwarded to the constructor of @p T.
+     */
+    template <typename... T_Args>
+    void emplace (T_Args&&... args) {
+        if (used_ == t_capacity) {
+            Slot& oldest = slot(0);
+            if (oldest.live) {
+                destroy(oldest);
+                ++dropped_;
+            }
+            head_ = (head_ + 1) % t_capacity;
+            --used_;
+        }
+
+        Slot& target = slot(used_);
+        std::construct_at(target.get(), std::forward<T_Args>(args)...);
+        target.live = true;
+        ++used_;
+        ++size_;
+    }
+
+    /**
+     * Remove the oldest live entry for which @p pred returns @c true.
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return @c true if an entry was removed.
+     */
+    template <typename T_Pred>
+    bool erase_first (T_Pred&& pred) {
+        for (auto off = next_live(0); off < used_; off = next_live(off + 1)) {
+            if (pred(*slot(off).get())) {
+                destroy(slot(off));
+                trim();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Remove every live entry for which @p pred returns @c true, in a single
+     * pass.
+     *
+     * @p pred is called exactly once per live entry, oldest first, so it may
+     * keep state between calls.
+     *
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return The number of entries removed.
+     */
+    template <typename T_Pred>
+    std::size_t erase_if (T_Pred&& pred) {
+        std::size_t num_erased = 0;
+        for (auto off = next_live(0); off < used_; off = next_live(off + 1)) {
+            if (pred(*slot(off).get())) {
+                destroy(slot(off));
+                ++num_erased;
+            }
+        }
+
+        // Trimming moves the head, so only do it once the scan is done.
+        trim();
+        return num_erased;
+    }
+
+    /**
+     * Remove all entries and reset the count of dropped entries.
+     */
+    void clear () {
+        if (slots_) {
+            for (std::size_t off = 0; off < used_; ++off) {
+                if (slot(off).live) {
+                    destroy(slot(off));
+                }
+            }
+        }
+        head_ = 0;
+        used_ = 0;
+        dropped_ = 0;
+    }
+
+  private:
+    Slot& slot (std::size_t offset) {
+        return slots_[(head_ + offset) % t_capacity];
+    }
+
+    Slot const& slot (std::size_t offset) const {
+        return slots_[(head_ + offset) % t_capacity];
+    }
+
+    std::size_t next_live (std::size_t offset) const {
+        while (offset < used_ and not slot(offset).live) {
+            ++offset;
+        }
+        return offset;
+    }
+
+    void destroy (Slot& target) {
+        std::destroy_at(target.get());
+        target.live = false;
+        --size_;
+    }
+
+    // Reclaim tombstones at the old end of the buffer.
+    void trim () {
+        while (used_ > 0 and not slot(0).live) {
+            head_ = (head_ + 1) % t_capacity;
+            --used_;
+        }
+    }
+
+    std::pmr::polymorphic_allocator<Slot> allocator_;
+    Slot* slots_;
+    std::size_t head_ = 0;
+    std::size_t used_ = 0;
+    std::size_t size_ = 0;
+    std::size_t dropped_ = 0;
+};
+
+/**
+ * Storage policy for @c Call_Log which keeps only the most recent calls.
+ *
+ * Memory use is fixed no matter how many calls are logged. Calls evicted before
+ * being consumed are counted and reported as dropped. See @c Ring_List.
+ *
+ * @tparam t_capacity Maximum number of calls kept.
+ */
+template <std::size_t t_capacity>
+struct Ring {
+    template <typename T>
+    using List = Ring_List<T, t_capacity>;
+};
+}  // namespace c2mm::mock::storage
+
+#endif  // C2MM__MOCK__STORAGE__RING_HPP_
@@ -0,0 +1,150 @@
+#include "c2mm/mock/storage/Ring.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+template <typename T_List>
+std::vector<int> contents (T_List const& list) {
+    std::vector<int> result{};
+    for (auto const& entry : list) {
+        result.push_back(*entry);
+    }
+    return result;
+}
+
+auto is (int value) {
+    return [value] (auto const& p) { return *p == value; };
+}
+}  // namespace
+
+SCENARIO ("c2mm::mock::storage::Ring_List keeps the most recent entries") {
+    using c2mm::mock::storage::Ring_List;
+
+    GIVEN ("a Ring_List") {
+        Ring_List<std::shared_ptr<int>, 4> list{};
+
+        WHEN ("fewer entries than its capacity are added") {
+            for (int i = 0; i < 3; ++i) {
+                list.emplace(std::make_shared<int>(i));
+            }
+
+            THEN ("they are all kept") {
+                CHECK(list.size() == 3);
+                CHECK(list.dropped() == 0);
+                CHECK(contents(list) == std::vector{0, 1, 2});
+            }
+        }
+
+        WHEN ("more entries than its capacity are added") {
+            auto first = std::make_shared<int>(0);
+            list.emplace(first);
+            for (int i = 1; i < 10; ++i) {
+                list.emplace(std::make_shared<int>(i));
+            }
+
+            THEN ("only the newest are kept") {
+                CHECK(list.size() == 4);
+                CHECK(list.dropped() == 6);
+                CHECK(contents(list) == std::vector{6, 7, 8, 9});
+                CHECK(first.use_count() == 1);
+            }
+
+            AND_WHEN ("the list is cleared") {
+                list.clear();
+
+                THEN ("the count of dropped entries is reset") {
+                    CHECK(list.empty());
+                    CHECK(list.dropped() == 0);
+                }
+            }
+        }
+
+        WHEN ("entries are consumed as they are added") {
+            for (int i = 0; i < 10; ++i) {
+                list.emplace(std::make_shared<int>(i));
+                CHECK(list.erase_first(is(i)));
+            }
+
+            THEN ("nothing is dropped") {
+                CHECK(list.empty());
+                CHECK(list.dropped() == 0);
+            }
+        }
+
+        WHEN ("an entry in the middle is consumed") {
+            for (int i = 0; i < 4; ++i) {
+                list.emplace(std::make_shared<int>(i));
+            }
+            CHECK(list.erase_first(is(2)));
+            CHECK(not list.erase_first(is(2)));
+
+            AND_WHEN ("the buffer wraps around") {
+                list.emplace(std::make_shared<int>(4));
+                list.emplace(std::make_shared<int>(5));
+
+                THEN ("only live entries are counted as dropped") {
+                    CHECK(contents(list) == std::vector{3, 4, 5});
+                    CHECK(list.dropped() == 2);
+                }
+            }
+        }
+
+        WHEN ("several entries are erased in one pass") {
+            for (int i = 0; i < 4; ++i) {
+                list.emplace(std::make_shared<int>(i));
+            }
+            std::vector<int> visited{};
+            CHECK(list.erase_if([&visited] (auto const& p) {
+                visited.push_back(*p);
+                return *p != 2;
+            }) == 3);
+
+            THEN ("each entry is visited once and the rest are kept") {
+                CHECK(visited == std::vector{0, 1, 2, 3});
+                CHECK(contents(list) == std::vector{2});
+            }
+
+            AND_WHEN ("the buffer wraps around") {
+                for (int i = 4; i < 8; ++i) {
+                    list.emplace(std::make_shared<int>(i));
+                }
+
+                THEN ("erased slots were reclaimed") {
+                    CHECK(contents(list) == std::vector{4, 5, 6, 7});
+                    CHECK(list.dropped() == 1);
+                }
+            }
+        }
+    }
+
+    GIVEN ("a Ring_List with a memory resource") {
+        alignas(std::max_align_t) std::byte buffer[4096];
+        std::pmr::monotonic_buffer_resource arena{
+            buffer,
+            sizeof(buffer),
+            std::pmr::null_memory_resource()
+        };
+        Ring_List<int, 4> list{&arena};
+
+        WHEN ("entries are added") {
+            for (int i = 0; i < 10; ++i) {
+                list.emplace(i);
+            }
+
+            THEN ("the buffer is allocated from the resource") {
+                CHECK(list.size() == 4);
+                for (int const& entry : list) {
+                    auto const* address =
+                        reinterpret_cast<std::byte const*>(&entry);
+                    CHECK(address >= buffer);
+                    CHECK(address < buffer + sizeof(buffer));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,290 @@
+#ifndef C2MM__MOCK__STORAGE__SHARDED_HPP_
+#define C2MM__MOCK__STORAGE__SHARDED_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+
+namespace c2mm::mock::storage {
+/**
+ * Call list which is safe to append to from multiple threads.
+ *
+ * Entries are distributed across @p t_num_shards independent lists, each with
+ * its own lock. Each thread always appends to the same shard so threads only
+ * contend when there are more threads than shards. Within a shard, entries are
+ * kept in the order they were added. The relative order of entries from
+ * different threads is not preserved.
+ *
+ * @c emplace, @c erase_first, @c size, @c empty and @c clear may be called
+ * concurrently. The total size is kept in an atomic counter, so @c size and
+ * @c empty don't take any shard's lock. Iteration is not synchronized and
+ * must not overlap with any modification.
+ *
+ * @tparam T The type of entry to store.
+ * @tparam T_Storage Storage policy used for each shard.
+ * @tparam t_num_shards Number of independent shards.
+ */
+template <typename T, typename T_Storage, std::size_t t_num_shards>
+class Sharded_List {
+    static_assert(t_num_shards > 0);
+
+    using Inner_List = typename T_Storage::template List<T>;
+
+    // Padded to a cache line so that threads appending to neighbouring shards
+    // don't contend.
+    struct alignas(64) Shard {
+        explicit Shard (std::pmr::memory_resource* resource)
+              : list{resource} {}
+
+        mutable std::mutex mutex;
+        Inner_List list;
+    };
+
+  public:
+    using value_type = T;
+
+    /**
+     * Entries from different threads are not kept in the order they were
+     * added.
+     */
+    static constexpr bool keeps_order = false;
+
+    /**
+     * Read-only iterator over the entries of every shard in turn.
+     */
+    class Iterator {
+        using Inner_Iterator = decltype(
+            std::declval<Inner_List const&>().begin()
+        );
+
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const*;
+        using reference = T const&;
+
+        Iterator () = default;
+        Iterator (Shard const* shards, std::size_t shard_idx)
+              : shards_{shards}, shard_idx_{shard_idx} {
+            skip_exhausted_shards();
+        }
+
+        reference operator * () const { return *iter_; }
+        pointer operator -> () const { return &*iter_; }
+
+        Iterator& operator ++ () {
+            ++iter_;
+            if (iter_ == shards_[shard_idx_].list.end()) {
+                ++shard_idx_;
+                skip_exhausted_shards();
+            }
+            return *this;
+        }
+
+        Iterator operator ++ (int) {
+            Iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        friend bool operator == (Iterator const& lhs, Iterator const& rhs) {
+            return lhs.shard_idx_ == rhs.shard_idx_ and (
+                lhs.shard_idx_ == t_num_shards or lhs.iter_ == rhs.iter_
+            );
+        }
+
+      private:
+        // Lists such as Counting_List count entries they don't store, so a
+        // shard which is not empty may still have nothing to iterate.
+        void skip_exhausted_shards () {
+            for (; shard_idx_ < t_num_shards; ++shard_idx_) {
+                auto const& list = shards_[shard_idx_].list;
+                if (list.begin() != list.end()) {
+                    iter_ = list.begin();
+                    return;
+                }
+            }
+        }
+
+        Shard const* shards_ = nullptr;
+        std::size_t shard_idx_ = t_num_shards;
+        Inner_Iterator iter_{};
+    };
+
+    /**
+     * Construct an empty list.
+     * @param[in] resource Memory resource from which the shards are
+     *     allocated. Each shard's list is constructed with it too.
+     */
+    explicit Sharded_List (
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+    ) : allocator_{resource},
+        shards_{allocator_.allocate(t_num_shards)} {
+        std::size_t idx = 0;
+        try {
+            for (; idx < t_num_shards; ++idx) {
+                std::construct_at(shards_ + idx, resource);
+            }
+        } catch (...) {
+            std::destroy_n(shards_, idx);
+            allocator_.deallocate(shards_, t_num_shards);
+            throw;
+        }
+    }
+
+    Sharded_List (Sharded_List&& other)
+          : allocator_{other.allocator_},
+            shards_{std::exchange(other.shards_, nullptr)},
+            size_{other.size_.exchange(0, std::memory_order_relaxed)}
+    {}
+
+    Sharded_List& operator = (Sharded_List&&) = delete;
+
+    ~Sharded_List () {
+        if (shards_) {
+            std::destroy_n(shards_, t_num_shards);
+            allocator_.deallocate(shards_, t_num_shards);
+        }
+    }
+
+    Iterator begin () const { return Iterator{shards_, 0}; }
+    Iterator end () const { return Iterator{shards_, t_num_shards}; }
+
+    /**
+     * Number of entries currently stored across all shards.
+     */
+    std::size_t size () const { return size_.load(std::memory_order_relaxed); }
+
+    /**
+     * Indicates whether there are no entries stored in any shard.
+     */
+    bool empty () const { return size() == 0; }
+
+    /**
+     * Number of entries the shards discarded before they could be consumed.
+     * Only available if the storage policy of each shard discards entries.
+     */
+    std::size_t dropped () const
+        requires requires (Inner_List const& list) { list.dropped(); }
+    {
+        std::size_t total = 0;
+        for (auto& shard : shards()) {
+            std::scoped_lock lock{shard.mutex};
+            total += shard.list.dropped();
+        }
+        return total;
+    }
+
+    /**
+     * Construct a new entry at the end of the calling thread's shard.
+     * @param[in] args... Arguments forwarded to the constructor of @p T.
+     */
+    template <typename... T_Args>
+    void emplace (T_Args&&... args) {
+        Shard& shard = shards_[this_thread_shard()];
+        std::scoped_lock lock{shard.mutex};
+        auto const prev_size = shard.list.size();
+        shard.list.emplace(std::forward<T_Args>(args)...);
+        // A shard which discards entries may not grow.
+        if (shard.list.size() != prev_size) {
+            size_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Remove the first entry for which @p pred returns @c true. Shards are
+     * searched in turn.
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return @c true if an entry was removed.
+     */
+    template <typename T_Pred>
+    bool erase_first (T_Pred&& pred) {
+        for (auto& shard : shards()) {
+            std::scoped_lock lock{shard.mutex};
+            if (shard.list.erase_first(pred)) {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Remove every entry for which @p pred returns @c true. Shards are
+     * searched in turn, each in a single pass.
+     *
+     * @p pred is called exactly once per entry, so it may keep state between
+     * calls. Entries of each shard are visited in order but shards are locked
+     * one at a time, so @p pred must not rely on the relative order of entries
+     * from different threads.
+     *
+     * @param[in] pred Unary predicate accepting a `T const&`.
+     * @return The number of entries removed.
+     */
+    template <typename T_Pred>
+    std::size_t erase_if (T_Pred&& pred) {
+        std::size_t num_erased = 0;
+        for (auto& shard : shards()) {
+            std::scoped_lock lock{shard.mutex};
+            num_erased += shard.list.erase_if(pred);
+        }
+        size_.fetch_sub(num_erased, std::memory_order_relaxed);
+        return num_erased;
+    }
+
+    /**
+     * Remove all entries from all shards.
+     */
+    void clear () {
+        for (auto& shard : shards()) {
+            std::scoped_lock lock{shard.mutex};
+            size_.fetch_sub(shard.list.size(), std::memory_order_relaxed);
+            shard.list.clear();
+        }
+    }
+
+  private:
+    static std::size_t this_thread_shard () {
+        static std::atomic<std::size_t> next_shard{0};
+        thread_local std::size_t const shard =
+            next_shard.fetch_add(1, std::memory_order_relaxed) % t_num_shards;
+        return shard;
+    }
+
+    struct Shard_Range {
+        Shard* first;
+        Shard* begin () const { return first; }
+        Shard* end () const { return first + t_num_shards; }
+    };
+
+    Shard_Range shards () const { return {shards_}; }
+
+    std::pmr::polymorphic_allocator<Shard> allocator_;
+    Shard* shards_;
+    // On its own cache line so that updating it doesn't evict the members
+    // above, which every call reads.
+    alignas(64) std::atomic<std::size_t> size_{0};
+};
+
+/**
+ * Storage policy for @c Call_Log which can be appended to concurrently.
+ *
+ * See @c Sharded_List.
+ *
+ * @tparam T_Storage Storage policy used for each shard.
+ * @tparam t_num_shards Number of independent shards.
+ */
+template <typename T_Storage, std::size_t t_num_shards = 16>
+struct Sharded {
+    template <typename T>
+    using List = Sharded_List<T, T_Storage, t_num_shards>;
+};
+}  // namespace c2mm::mock::storage
+
+#endif  // C2MM__MOCK__STORAGE__SHARDED_HPP_
@@ -0,0 +1,161 @@
+#include "c2mm/mock/storage/Sharded.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/mock/storage/Chunked.hpp"
+#include "c2mm/mock/storage/Heap.hpp"
+#include "c2mm/mock/storage/Ring.hpp"
+
+namespace {
+template <typename T_List>
+constexpr bool counts_dropped = requires (T_List const& list) {
+    list.dropped();
+};
+}  // namespace
+
+SCENARIO ("c2mm::mock::storage::Sharded_List can be appended to concurrently") {
+    using c2mm::mock::storage::Chunked;
+    using c2mm::mock::storage::Heap;
+    using c2mm::mock::storage::Sharded_List;
+
+    GIVEN ("a Sharded_List") {
+        Sharded_List<std::pair<int, int>, Chunked<8>, 4> list{};
+
+        WHEN ("several threads add entries at once") {
+            constexpr int num_threads = 8;
+            constexpr int num_entries = 500;
+
+            std::vector<std::thread> threads{};
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&list, t] {
+                    for (int i = 0; i < num_entries; ++i) {
+                        list.emplace(t, i);
+                    }
+                });
+            }
+            // The size may be read while entries are added.
+            std::size_t max_size = 0;
+            while (max_size < num_threads * num_entries) {
+                max_size = std::max(max_size, list.size());
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            THEN ("every entry is stored") {
+                CHECK(list.size() == num_threads * num_entries);
+                CHECK(std::distance(list.begin(), list.end())
+                    == num_threads * num_entries);
+            }
+
+            THEN ("entries from one thread keep their order") {
+                std::vector<int> last(num_threads, -1);
+                bool ordered = true;
+                for (auto const& [t, i] : list) {
+                    ordered = ordered and i > last[t];
+                    last[t] = i;
+                }
+                CHECK(ordered);
+            }
+
+            AND_WHEN ("entries are erased concurrently") {
+                threads.clear();
+                for (int t = 0; t < num_threads; ++t) {
+                    threads.emplace_back([&list, t] {
+                        for (int i = 0; i < num_entries; ++i) {
+                            list.erase_first([=] (auto const& entry) {
+                                return entry == std::pair{t, i};
+                            });
+                        }
+                    });
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+
+                THEN ("the list is empty") {
+                    CHECK(list.empty());
+                    CHECK(list.begin() == list.end());
+                }
+            }
+        }
+    }
+
+    GIVEN ("a Sharded_List with a memory resource") {
+        alignas(std::max_align_t) std::byte buffer[4096];
+        std::pmr::monotonic_buffer_resource arena{
+            buffer,
+            sizeof(buffer),
+            std::pmr::null_memory_resource()
+        };
+        Sharded_List<int, Heap, 2> list{&arena};
+
+        WHEN ("entries are added") {
+            for (int i = 0; i < 10; ++i) {
+                list.emplace(i);
+            }
+
+            THEN ("every shard allocates from the resource") {
+                CHECK(list.size() == 10);
+                for (int const& entry : list) {
+                    auto const* address =
+                        reinterpret_cast<std::byte const*>(&entry);
+                    CHECK(address >= buffer);
+                    CHECK(address < buffer + sizeof(buffer));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE ("c2mm::mock::storage::Sharded_List iterates across shards") {
+    using c2mm::mock::storage::Heap;
+    using c2mm::mock::storage::Sharded_List;
+
+    Sharded_List<int, Heap, 3> list{};
+    CHECK(list.begin() == list.end());
+
+    list.emplace(1);
+    list.emplace(2);
+    CHECK(std::vector(list.begin(), list.end()) == std::vector{1, 2});
+
+    CHECK(list.erase_first([] (int value) { return value == 1; }));
+    CHECK(std::vector(list.begin(), list.end()) == std::vector{2});
+    CHECK(list.size() == 1);
+
+    list.emplace(3);
+    list.emplace(4);
+    CHECK(list.erase_if([] (int value) { return value > 2; }) == 2);
+    CHECK(list.size() == 1);
+
+    list.clear();
+    CHECK(list.empty());
+}
+
+TEST_CASE ("c2mm::mock::storage::Sharded_List counts entries shards drop") {
+    using c2mm::mock::storage::Heap;
+    using c2mm::mock::storage::Ring;
+    using c2mm::mock::storage::Sharded_List;
+
+    Sharded_List<int, Ring<4>, 2> list{};
+    for (int i = 0; i < 10; ++i) {
+        list.emplace(i);
+    }
+
+    // Every entry is added by this thread, so to the same shard.
+    CHECK(list.size() == 4);
+    CHECK(list.dropped() == 6);
+
+    list.clear();
+    CHECK(list.size() == 0);
+    CHECK(list.dropped() == 0);
+
+    STATIC_CHECK(not counts_dropped<Sharded_List<int, Heap, 2>>);
+}
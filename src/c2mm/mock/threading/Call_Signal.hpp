@@ -0,0 +1,90 @@
+#ifndef C2MM__MOCK__THREADING__CALL_SIGNAL_HPP_
+#define C2MM__MOCK__THREADING__CALL_SIGNAL_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace c2mm::mock::threading {
+/**
+ * Wakes threads waiting for a mock to log a call.
+ *
+ * Notifying is a fence and a load of the number of waiting threads unless a
+ * thread is waiting, so a mock which nobody waits on never writes to shared
+ * state, takes the lock or touches the condition variable.
+ */
+class Call_Signal {
+  public:
+    Call_Signal () = default;
+    Call_Signal (Call_Signal const&) = delete;
+    Call_Signal& operator = (Call_Signal const&) = delete;
+
+    /**
+     * Wake every waiting thread to check its condition again.
+     */
+    void notify () {
+        // Pairs with the fence in @c wait_until: either this sees the waiter
+        // or the waiter's condition sees what changed before this call.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_waiting_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        {
+            // Taking the lock orders this with a waiter between checking its
+            // condition and blocking.
+            std::scoped_lock lock{mutex_};
+            generation_.fetch_add(1);
+        }
+        changed_.notify_all();
+    }
+
+    /**
+     * Block until @p condition returns @c true or @p deadline passes.
+     *
+     * @p condition is called without any lock held, once up front and again
+     * after each notification.
+     *
+     * @param[in] deadline Time after which to stop waiting.
+     * @param[in] condition Nullary predicate.
+     *
+     * @return @c true if @p condition returned @c true. Else returns @c false.
+     */
+    template <typename T_Clock, typename T_Duration, typename T_Condition>
+    bool wait_until (
+        std::chrono::time_point<T_Clock, T_Duration> const& deadline,
+        T_Condition&& condition
+    ) {
+        num_waiting_.fetch_add(1);
+        struct Leave {
+            std::atomic<std::uint32_t>& num_waiting;
+            ~Leave () { num_waiting.fetch_sub(1); }
+        } const leave{num_waiting_};
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        while (true) {
+            auto const seen = generation_.load();
+            if (condition()) {
+                return true;
+            }
+
+            std::unique_lock lock{mutex_};
+            if (not changed_.wait_until(lock, deadline, [&] {
+                return generation_.load() != seen;
+            })) {
+                return false;
+            }
+        }
+    }
+
+  private:
+    std::atomic<std::uint64_t> generation_{0};
+    std::atomic<std::uint32_t> num_waiting_{0};
+    std::mutex mutex_{};
+    std::condition_variable changed_{};
+};
+}  // namespace c2mm::mock::threading
+
+#endif  // C2MM__MOCK__THREADING__CALL_SIGNAL_HPP_
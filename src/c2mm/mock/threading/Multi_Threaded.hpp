@@ -0,0 +1,50 @@
+#ifndef C2MM__MOCK__THREADING__MULTI_THREADED_HPP_
+#define C2MM__MOCK__THREADING__MULTI_THREADED_HPP_
+
+#include <cstddef>
+#include <mutex>
+
+#include "c2mm/mock/storage/Sharded.hpp"
+#include "c2mm/mock/threading/Call_Signal.hpp"
+
+namespace c2mm::mock::threading {
+/**
+ * A threading policy for mocks which are called from several threads at once.
+ *
+ * Calls which no expectation consumes are appended to a @c storage::Sharded
+ * log, so concurrent callers rarely contend with each other. Matching a call
+ * against expectations and consuming it happen together under one lock. The
+ * action of the expectation which handles a call runs after the lock is
+ * released, so actions may run concurrently and may call the same mock. A
+ * mock with only call expectations (see @c Mock_Function::expect_call) counts
+ * calls without the lock.
+ *
+ * Expectations should be set up before the mock is shared between threads.
+ * Verification may run concurrently with calls, and a test may block until
+ * another thread makes a call.
+ *
+ * @tparam t_num_shards Number of independent shards in the call log.
+ */
+template <std::size_t t_num_shards = 16>
+struct Multi_Threaded {
+    /**
+     * Lock guarding the expectations of a mock.
+     */
+    using Mutex = std::mutex;
+
+    /**
+     * Wakes threads waiting for calls to be logged, e.g. in @c
+     * Mock_Function::wait_for_call.
+     */
+    using Call_Signal = threading::Call_Signal;
+
+    /**
+     * Adapt the storage policy of a mock's @c Call_Log so that calls can be
+     * logged concurrently.
+     */
+    template <typename T_Storage>
+    using Log_Storage = storage::Sharded<T_Storage, t_num_shards>;
+};
+}  // namespace c2mm::mock::threading
+
+#endif  // C2MM__MOCK__THREADING__MULTI_THREADED_HPP_
@@ -0,0 +1,54 @@
+#ifndef C2MM__MOCK__THREADING__SINGLE_THREADED_HPP_
+#define C2MM__MOCK__THREADING__SINGLE_THREADED_HPP_
+
+namespace c2mm::mock::threading {
+/**
+ * A lockable type whose operations do nothing.
+ */
+struct Null_Mutex {
+    constexpr void lock () {}
+    constexpr bool try_lock () { return true; }
+    constexpr void unlock () {}
+};
+
+/**
+ * A signal which never wakes anyone. Without other threads, a condition which
+ * is false cannot become true by waiting.
+ */
+struct Null_Call_Signal {
+    constexpr void notify () {}
+
+    template <typename T_Deadline, typename T_Condition>
+    bool wait_until (T_Deadline const&, T_Condition&& condition) {
+        return condition();
+    }
+};
+
+/**
+ * A threading policy for mocks which are only called from one thread at a
+ * time.
+ *
+ * This is the default policy. It adds no synchronization at all.
+ */
+struct Single_Threaded {
+    /**
+     * Lock guarding the expectations of a mock.
+     */
+    using Mutex = Null_Mutex;
+
+    /**
+     * Wakes threads waiting for calls to be logged. Waiting checks once and
+     * never blocks.
+     */
+    using Call_Signal = Null_Call_Signal;
+
+    /**
+     * Adapt the storage policy of a mock's @c Call_Log. This policy uses it
+     * unchanged.
+     */
+    template <typename T_Storage>
+    using Log_Storage = T_Storage;
+};
+}  // namespace c2mm::mock::threading
+
+#endif  // C2MM__MOCK__THREADING__SINGLE_THREADED_HPP_
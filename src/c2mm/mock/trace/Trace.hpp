@@ -0,0 +1,236 @@
+#ifndef C2MM__MOCK__TRACE__TRACE_HPP_
+#define C2MM__MOCK__TRACE__TRACE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "c2mm/mock/Serializer.hpp"
+#include "c2mm/mock/trace/format.hpp"
+
+namespace c2mm::mock::trace {
+/**
+ * Primary template for @c Trace is intentionally not defined.
+ *
+ * See specializations for full documentation.
+ */
+template <typename T_Signature>
+class Trace;
+
+/**
+ * The calls recorded in a trace file by a @c Writer, decoded up front so
+ * that they can be replayed without any decoding cost. See @c replay.
+ *
+ * @tparam T_Return The return type of the function.
+ * @tparam T_Parameters The parameter types of the function.
+ */
+template <typename T_Return, typename... T_Parameters>
+class Trace<T_Return(T_Parameters...)> {
+  public:
+    using Signature = T_Return(T_Parameters...);
+    using Args = Arg_Values_t<Signature>;
+
+    /**
+     * A recorded call.
+     */
+    struct Call {
+        /// Nanoseconds since recording started, or zero if the trace has no
+        /// timestamps.
+        std::uint64_t timestamp;
+        /// The values of the arguments.
+        Args args;
+    };
+
+    /**
+     * Read and decode the trace at @p path.
+     *
+     * @param[in] path Path of a trace file written by a @c Writer with the
+     *     same signature.
+     *
+     * @throws std::runtime_error If the file cannot be read, is not a trace
+     *     of this version or is corrupt.
+     */
+    explicit Trace (std::filesystem::path const& path) {
+        static_assert(
+            Recordable<Signature>,
+            "Every parameter type must be Serializable."
+        );
+
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        if (not file) {
+            throw std::runtime_error{
+                "cannot open trace file " + path.string()
+            };
+        }
+        std::vector<std::byte> bytes(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(
+            reinterpret_cast<char*>(bytes.data()),
+            static_cast<std::streamsize>(bytes.size())
+        );
+
+        std::byte const* in = bytes.data();
+        std::byte const* const end = in + bytes.size();
+
+        auto const header = read<File_Header>(in, end);
+        if (
+            header.magic != File_Header::expected_magic or
+            header.version != File_Header::current_version
+        ) {
+            throw std::runtime_error{"not a c2mm trace: " + path.string()};
+        }
+        flags_ = header.flags;
+
+        while (in != end) {
+            std::uint64_t timestamp = 0;
+            if (is_set(flags_, Flags::timestamps)) {
+                timestamp = read<std::uint64_t>(in, end);
+            }
+
+            auto const size = read<std::uint32_t>(in, end);
+            require(in, end, size);
+            check_record(in, in + size);
+            calls_.push_back({timestamp, Serializer<Args>::read(in, size)});
+            in += size;
+        }
+    }
+
+    /**
+     * Options the trace was recorded with.
+     */
+    Flags flags () const { return flags_; }
+
+    /**
+     * Number of recorded calls.
+     */
+    std::size_t size () const { return calls_.size(); }
+
+    /**
+     * The recorded calls, in the order they were made.
+     */
+    std::vector<Call> const& calls () const { return calls_; }
+
+    auto begin () const { return calls_.begin(); }
+    auto end () const { return calls_.end(); }
+
+  private:
+    static void require (
+        std::byte const* in,
+        std::byte const* end,
+        std::size_t size
+    ) {
+        if (static_cast<std::size_t>(end - in) < size) {
+            throw std::runtime_error{"truncated c2mm trace"};
+        }
+    }
+
+    // Check that each element of a record lies within it before it is
+    // decoded, since @c Serializer trusts the lengths it is given.
+    static void check_record (std::byte const* in, std::byte const* end) {
+        [&in, end] <typename... T_Elements> (
+            std::type_identity<std::tuple<T_Elements...>>
+        ) {
+            (check_element<T_Elements>(in, end), ...);
+        }(std::type_identity<Args>{});
+
+        if (in != end) {
+            throw std::runtime_error{"corrupt c2mm trace"};
+        }
+    }
+
+    template <typename T_Element>
+    static void check_element (std::byte const*& in, std::byte const* end) {
+        auto const length =
+            read<typename Serializer<Args>::Length>(in, end);
+        require(in, end, length);
+        if constexpr (std::is_trivially_copyable_v<T_Element>) {
+            if (length != sizeof(T_Element)) {
+                throw std::runtime_error{"corrupt c2mm trace"};
+            }
+        }
+        in += length;
+    }
+
+    template <typename T>
+    static T read (std::byte const*& in, std::byte const* end) {
+        require(in, end, sizeof(T));
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return value;
+    }
+
+    Flags flags_ = Flags::none;
+    std::vector<Call> calls_{};
+};
+
+namespace impl_ {
+// Parameters which a recorded value can't bind to directly are passed a copy.
+template <typename T_Parameter>
+inline constexpr bool needs_copy =
+    std::is_rvalue_reference_v<T_Parameter> or (
+        std::is_lvalue_reference_v<T_Parameter> and
+        not std::is_const_v<std::remove_reference_t<T_Parameter>>
+    );
+
+template <typename T_Parameter, typename T_Value>
+decltype(auto) hold (T_Value const& value) {
+    if constexpr (needs_copy<T_Parameter>) {
+        return T_Value(value);
+    } else {
+        return (value);
+    }
+}
+
+template <typename T_Parameter>
+using Pass = std::conditional_t<
+    std::is_reference_v<T_Parameter>,
+    T_Parameter,
+    std::remove_cv_t<T_Parameter> const&
+>;
+}  // namespace impl_
+
+/**
+ * Call @p target with the arguments of every call in @p trace, in order, as
+ * fast as possible. Timestamps are ignored and results are discarded.
+ *
+ * Each argument is passed as a reference to the value in @p trace unless the
+ * parameter is an rvalue reference or a non-const lvalue reference, in which
+ * case a copy is passed. The same trace can be replayed any number of times.
+ *
+ * @param[in] trace The calls to replay.
+ * @param[in] target Callable accepting arguments of the traced signature,
+ *     e.g. the real implementation behind a mocked interface.
+ */
+template <typename T_Return, typename... T_Parameters, typename T_Target>
+void replay (Trace<T_Return(T_Parameters...)> const& trace, T_Target&& target) {
+    for (auto const& call : trace) {
+        std::apply(
+            [&target] (auto const&... values) {
+                std::apply(
+                    [&target] (auto&&... held) {
+                        std::invoke(
+                            target,
+                            static_cast<impl_::Pass<T_Parameters>>(held)...
+                        );
+                    },
+                    std::forward_as_tuple(
+                        impl_::hold<T_Parameters>(values)...
+                    )
+                );
+            },
+            call.args
+        );
+    }
+}
+}  // namespace c2mm::mock::trace
+
+#endif  // C2MM__MOCK__TRACE__TRACE_HPP_
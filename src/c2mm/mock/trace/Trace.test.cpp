@@ -0,0 +1,196 @@
+#include "c2mm/mock/trace/Trace.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "c2mm/mock/Mock_Function.hpp"
+#include "c2mm/mock/trace/Writer.hpp"
+
+namespace {
+// A trace file which is removed at the end of the test.
+struct Temp_Path {
+    std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "c2mm-trace.test.bin";
+
+    ~Temp_Path () { std::filesystem::remove(path); }
+};
+
+// Overwrite the bytes of a file at @p offset with the representation of @p
+// value.
+void patch (
+    std::filesystem::path const& path,
+    std::streamoff offset,
+    std::uint32_t value
+) {
+    std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(offset);
+    file.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+}  // namespace
+
+SCENARIO ("c2mm::mock::trace records and replays calls") {
+    using namespace c2mm::mock::trace;
+    using Signature = void(int, std::string const&);
+
+    Temp_Path const file{};
+
+    GIVEN ("a trace written with timestamps") {
+        {
+            Writer<Signature> writer{file.path, Flags::timestamps};
+            writer.write(1, "one");
+            writer.write(2, "two");
+            writer.write(3, std::string(100, 'x'));
+            CHECK(writer.size() == 3);
+        }
+
+        WHEN ("it is read back") {
+            Trace<Signature> const trace{file.path};
+
+            THEN ("every call is decoded in order") {
+                CHECK(trace.flags() == Flags::timestamps);
+                REQUIRE(trace.size() == 3);
+                CHECK(trace.calls()[0].args == std::tuple{1, "one"});
+                CHECK(trace.calls()[1].args == std::tuple{2, "two"});
+                CHECK(std::get<1>(trace.calls()[2].args).size() == 100);
+                CHECK(trace.calls()[0].timestamp <=
+                    trace.calls()[2].timestamp);
+            }
+
+            THEN ("it can be replayed more than once") {
+                std::vector<int> ids{};
+                auto const target = [&ids] (int id, std::string const&) {
+                    ids.push_back(id);
+                };
+                replay(trace, target);
+                replay(trace, target);
+                CHECK(ids == std::vector{1, 2, 3, 1, 2, 3});
+            }
+        }
+    }
+
+    GIVEN ("a trace of calls with reference parameters") {
+        using Ref_Signature = void(std::string&&, int&, int const&, double);
+        {
+            Writer<Ref_Signature> writer{file.path};
+            writer.write("moved", 4, 5, 6.5);
+        }
+        Trace<Ref_Signature> const trace{file.path};
+
+        THEN ("copies are passed where a recorded value can't bind") {
+            std::string taken{};
+            replay(
+                trace,
+                [&taken] (std::string&& text, int& out, int const&, double) {
+                    taken = std::move(text);
+                    out = 0;
+                }
+            );
+            CHECK(taken == "moved");
+            CHECK(trace.calls()[0].args == std::tuple{"moved", 4, 5, 6.5});
+        }
+    }
+
+    GIVEN ("a trace with flags this version does not know") {
+        {
+            Writer<Signature> writer{file.path, Flags::timestamps};
+            writer.write(1, "one");
+        }
+        patch(file.path, offsetof(File_Header, flags), 0b11);
+
+        THEN ("the flags it knows are still honoured") {
+            Trace<Signature> const trace{file.path};
+            REQUIRE(trace.size() == 1);
+            CHECK(trace.calls()[0].args == std::tuple{1, "one"});
+        }
+    }
+
+    GIVEN ("a trace whose element lengths are corrupt") {
+        {
+            Writer<Signature> writer{file.path};
+            writer.write(1, "one");
+        }
+        // After the header and the size of the call: the length of the int,
+        // the int and the length of the string.
+        auto const first = static_cast<std::streamoff>(
+            sizeof(File_Header) + sizeof(std::uint32_t)
+        );
+        auto const second = first + 2 * sizeof(std::uint32_t);
+
+        WHEN ("an element claims more bytes than the call holds") {
+            patch(file.path, second, 0x7fff'ffff);
+
+            THEN ("reading it throws") {
+                CHECK_THROWS_AS(
+                    Trace<Signature>{file.path},
+                    std::runtime_error
+                );
+            }
+        }
+
+        WHEN ("an element is shorter than its type") {
+            patch(file.path, first, 1);
+
+            THEN ("reading it throws") {
+                CHECK_THROWS_AS(
+                    Trace<Signature>{file.path},
+                    std::runtime_error
+                );
+            }
+        }
+    }
+
+    GIVEN ("a file which is not a trace") {
+        std::ofstream{file.path} << "definitely not a trace";
+
+        THEN ("reading it throws") {
+            CHECK_THROWS_AS(Trace<Signature>{file.path}, std::runtime_error);
+        }
+    }
+}
+
+SCENARIO ("A recorded Mock_Function can be replayed into a real function.") {
+    using namespace c2mm::mock::trace;
+    using Signature = int(int, std::string);
+
+    Temp_Path const file{};
+
+    GIVEN ("the calls a Mock_Function received in a test") {
+        {
+            Writer<Signature> writer{file.path};
+            c2mm::mock::Mock_Function<Signature> func{};
+            func.record(writer);
+
+            func(1, std::string{"a"});
+            func(2, std::string{"bb"});
+            func.stop_recording();
+            func(3, std::string{"ccc"});
+
+            func.check_call_count(3);
+            CHECK(writer.size() == 2);
+        }
+
+        WHEN ("they are replayed into a real implementation") {
+            std::size_t total = 0;
+            replay(
+                Trace<Signature>{file.path},
+                [&total] (int id, std::string text) {
+                    total += id * text.size();
+                    return 0;
+                }
+            );
+
+            THEN ("it receives the same calls") {
+                CHECK(total == 1 * 1 + 2 * 2);
+            }
+        }
+    }
+}
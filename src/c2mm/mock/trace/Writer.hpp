@@ -0,0 +1,177 @@
+#ifndef C2MM__MOCK__TRACE__WRITER_HPP_
+#define C2MM__MOCK__TRACE__WRITER_HPP_
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "c2mm/mock/Serializer.hpp"
+#include "c2mm/mock/trace/format.hpp"
+
+namespace c2mm::mock::trace {
+/**
+ * Primary template for @c Writer is intentionally not defined.
+ *
+ * See specializations for full documentation.
+ */
+template <typename T_Signature>
+class Writer;
+
+/**
+ * Writes the calls made to a function into a trace file, in the format
+ * described by @c File_Header.
+ *
+ * Calls are buffered and written to the file in large blocks. Pass a @c
+ * Writer to @c Mock_Function::record to record the calls a mock receives, and
+ * read the trace back with @c Trace.
+ *
+ * A @c Writer is not synchronized. @c Mock_Function serializes the calls it
+ * records.
+ *
+ * @tparam T_Return The return type of the function. Not recorded.
+ * @tparam T_Parameters The parameter types of the function. Must be @c
+ *     Serializable once references and cv-qualifiers are removed.
+ */
+template <typename T_Return, typename... T_Parameters>
+class Writer<T_Return(T_Parameters...)> {
+  public:
+    using Signature = T_Return(T_Parameters...);
+
+    /**
+     * Create or truncate the file at @p path and write the trace header.
+     *
+     * @param[in] path Path of the trace file.
+     * @param[in] flags Options of the trace.
+     *
+     * @throws std::system_error If the file cannot be opened or written.
+     */
+    explicit Writer (
+        std::filesystem::path const& path,
+        Flags flags = Flags::none
+    ) : file_{std::fopen(path.c_str(), "wb")},
+        flags_{flags},
+        start_{Clock::now()} {
+        static_assert(
+            Recordable<Signature>,
+            "Every parameter type must be Serializable."
+        );
+
+        if (not file_) {
+            throw std::system_error{
+                errno,
+                std::generic_category(),
+                "cannot open trace file"
+            };
+        }
+
+        buffer_.reserve(buffer_capacity);
+        append(File_Header{.flags = flags});
+    }
+
+    Writer (Writer const&) = delete;
+    Writer& operator = (Writer const&) = delete;
+
+    /**
+     * Write any buffered calls and close the file. Errors are ignored; call
+     * @c flush first to detect them.
+     */
+    ~Writer () {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        std::fclose(file_);
+    }
+
+    /**
+     * Number of calls recorded.
+     */
+    std::size_t size () const { return size_; }
+
+    /**
+     * Record a call.
+     * @param[in] args... The arguments of the call.
+     * @throws std::system_error If a full buffer cannot be written.
+     */
+    void write (std::remove_cvref_t<T_Parameters> const&... args) {
+        if (is_set(flags_, Flags::timestamps)) {
+            append(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now() - start_
+                ).count()
+            ));
+        }
+
+        append(static_cast<std::uint32_t>(
+            ((sizeof(Length) + serialized_size(args)) + ... + 0)
+        ));
+        (append_element(args), ...);
+        ++size_;
+
+        if (buffer_.size() >= buffer_capacity) {
+            flush();
+        }
+    }
+
+    /**
+     * Write every buffered call to the file.
+     * @throws std::system_error If the file cannot be written.
+     */
+    void flush () {
+        if (
+            std::fwrite(buffer_.data(), 1, buffer_.size(), file_) !=
+                buffer_.size() or
+            std::fflush(file_) != 0
+        ) {
+            throw std::system_error{
+                errno,
+                std::generic_category(),
+                "cannot write trace file"
+            };
+        }
+        buffer_.clear();
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+    // Matches the per-element size prefix of `Serializer<std::tuple<...>>`.
+    using Length = std::uint32_t;
+
+    static constexpr std::size_t buffer_capacity = std::size_t{1} << 20;
+
+    template <typename T>
+    static std::size_t serialized_size (T const& value) {
+        return Serializer<T>::size(value);
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void append (T const& value) {
+        auto const offset = buffer_.size();
+        buffer_.resize(offset + sizeof(T));
+        std::memcpy(buffer_.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    void append_element (T const& value) {
+        auto const length = serialized_size(value);
+        append(static_cast<Length>(length));
+
+        auto const offset = buffer_.size();
+        buffer_.resize(offset + length);
+        Serializer<T>::write(value, buffer_.data() + offset);
+    }
+
+    std::FILE* file_;
+    Flags flags_;
+    Clock::time_point start_;
+    std::vector<std::byte> buffer_{};
+    std::size_t size_ = 0;
+};
+}  // namespace c2mm::mock::trace
+
+#endif  // C2MM__MOCK__TRACE__WRITER_HPP_
@@ -0,0 +1,79 @@
+#ifndef C2MM__MOCK__TRACE__FORMAT_HPP_
+#define C2MM__MOCK__TRACE__FORMAT_HPP_
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "c2mm/mock/Serializer.hpp"
+
+namespace c2mm::mock::trace {
+/**
+ * Primary template for @c Arg_Values is intentionally not defined.
+ */
+template <typename T_Signature>
+struct Arg_Values;
+
+/**
+ * The values of the arguments of a call to a function with signature @p
+ * T_Signature, as stored in a trace.
+ */
+template <typename T_Return, typename... T_Parameters>
+struct Arg_Values<T_Return(T_Parameters...)> {
+    using type = std::tuple<std::remove_cvref_t<T_Parameters>...>;
+};
+
+template <typename T_Signature>
+using Arg_Values_t = typename Arg_Values<T_Signature>::type;
+
+/**
+ * Functions whose calls can be recorded: those whose every parameter type is
+ * @c Serializable.
+ */
+template <typename T_Signature>
+concept Recordable = Serializable<Arg_Values_t<T_Signature>>;
+
+/**
+ * Options of a trace, stored in its header.
+ */
+enum class Flags : std::uint32_t {
+    none = 0,
+    /// Each call is preceded by its timestamp.
+    timestamps = 1,
+};
+
+/**
+ * Whether @p flag is set in @p flags.
+ */
+constexpr bool is_set (Flags flags, Flags flag) {
+    return (
+        static_cast<std::uint32_t>(flags) & static_cast<std::uint32_t>(flag)
+    ) != 0;
+}
+
+/**
+ * Start of every trace file.
+ *
+ * Each call follows the header in the order it was made, as:
+ *  - If @c Flags::timestamps is set, a `std::uint64_t` of nanoseconds since
+ *    recording started.
+ *  - A `std::uint32_t` size in bytes.
+ *  - The arguments of the call, as @c Serializer encodes them in an @c
+ *    Arg_Values tuple.
+ *
+ * Integers are in the byte order of the machine which recorded the trace.
+ */
+struct File_Header {
+    static constexpr std::array<char, 8> expected_magic{
+        'C', '2', 'M', 'M', 'T', 'R', 'C', '\0'
+    };
+    static constexpr std::uint32_t current_version = 1;
+
+    std::array<char, 8> magic = expected_magic;
+    std::uint32_t version = current_version;
+    Flags flags = Flags::none;
+};
+}  // namespace c2mm::mock::trace
+
+#endif  // C2MM__MOCK__TRACE__FORMAT_HPP_